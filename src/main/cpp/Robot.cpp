@@ -4,7 +4,9 @@
 
 #include <Robot.h>
 #include <cameraserver/CameraServer.h>
+#include <frc/DriverStation.h>
 
+#include <auton/AutonValidator.h>
 #include <auton/CyclePrimitives.h>
 #include <gamepad/TeleopControl.h>
 #include <states/chassis/SwerveDrive.h>
@@ -13,8 +15,12 @@
 #include <states/Intake/LeftIntakeStateMgr.h>
 #include <states/Intake/RightIntakeStateMgr.h>
 #include <states/shooter/ShooterStateMgr.h>
+#include <states/StateTrace.h>
 #include <subsys/ChassisFactory.h>
 #include <subsys/interfaces/IChassis.h>
+#include <utils/InitScheduler.h>
+#include <utils/LoopScheduler.h>
+#include <utils/Logger.h>
 #include <xmlhw/RobotDefn.h>
 
 
@@ -23,24 +29,88 @@ void Robot::RobotInit()
     //CameraServer::SetSize(CameraServer::kSize320x240);
     //CameraServer::StartAutomaticCapture();
 
-    // Read the XML file to build the robot 
-    auto defn = new RobotDefn();
-    defn->ParseXML();
+    // Read the XML file to build the robot.  The mechanisms are deferred so the 
+    // chassis is drivable as soon as possible.
+    m_robotDefn = new RobotDefn();
+    m_robotDefn->ParseXML(true);
 
     // Get local copies of the teleop controller and the chassis
     m_controller = TeleopControl::GetInstance();
     auto factory = ChassisFactory::GetChassisFactory();
     m_chassis = factory->GetIChassis();
     m_swerve = (m_chassis != nullptr) ? new SwerveDrive() : nullptr;
-        
-    m_leftIntakeStateMgr = LeftIntakeStateMgr::GetInstance();
-    m_rightIntakeStateMgr = RightIntakeStateMgr::GetInstance();
-    m_indexerStateMgr = IndexerStateMgr::GetInstance();
-    m_liftStateMgr = LiftStateMgr::GetInstance();
-    m_shooterStateMgr = ShooterStateMgr::GetInstance();
-    m_climberStateMgr = ClimberStateMgr::GetInstance();
+    Logger::GetLogger()->ToNtTable(std::string("InitScheduler"), std::string("drivable"), std::string(m_swerve != nullptr ? "true" : "false"));
 
     m_cyclePrims = new CyclePrimitives();
+
+    // The mechanisms and their state managers are created incrementally in DisabledPeriodic
+    // (or all at once if the robot is enabled first).  Each state manager stays nullptr until
+    // it is ready.
+    m_leftIntakeStateMgr = nullptr;
+    m_rightIntakeStateMgr = nullptr;
+    m_indexerStateMgr = nullptr;
+    m_liftStateMgr = nullptr;
+    m_shooterStateMgr = nullptr;
+    m_climberStateMgr = nullptr;
+
+    m_initScheduler = new InitScheduler(std::string("InitScheduler"));
+    m_initScheduler->AddStep(std::string("mechanisms"), [this]() { return m_robotDefn->ParseNextMechanism(); });
+    m_initScheduler->AddStep(std::string("left intake"), [this]() { m_leftIntakeStateMgr = LeftIntakeStateMgr::GetInstance(); return true; });
+    m_initScheduler->AddStep(std::string("right intake"), [this]() { m_rightIntakeStateMgr = RightIntakeStateMgr::GetInstance(); return true; });
+    m_initScheduler->AddStep(std::string("indexer"), [this]() { m_indexerStateMgr = IndexerStateMgr::GetInstance(); return true; });
+    m_initScheduler->AddStep(std::string("shooter"), [this]() { m_shooterStateMgr = ShooterStateMgr::GetInstance(); return true; });
+    m_initScheduler->AddStep(std::string("lift"), [this]() { m_liftStateMgr = LiftStateMgr::GetInstance(); return true; });
+    m_initScheduler->AddStep(std::string("climber"), [this]() { m_climberStateMgr = ClimberStateMgr::GetInstance(); return true; });
+
+    // The teleop work runs at the rate each subsystem needs.  The lift and climber are idle most 
+    // of the match, so they only check for a request at 10 Hz until they are used (the lift also runs 
+    // at 50 Hz while shooting).
+    m_loopScheduler = new LoopScheduler(std::string("LoopScheduler"), 1.0 / GetPeriod().value());
+    m_loopScheduler->AddTask(std::string("chassis"), [this]() 
+    { 
+        if (m_chassis != nullptr && m_controller != nullptr && m_swerve != nullptr)
+        {
+            m_swerve->Run();
+        }
+    }, 50.0);
+    m_loopScheduler->AddTask(std::string("left intake"), [this]() { if (m_leftIntakeStateMgr != nullptr) { m_leftIntakeStateMgr->RunCurrentState(); } }, 50.0);
+    m_loopScheduler->AddTask(std::string("right intake"), [this]() { if (m_rightIntakeStateMgr != nullptr) { m_rightIntakeStateMgr->RunCurrentState(); } }, 50.0);
+    m_loopScheduler->AddTask(std::string("shooter"), [this]() { if (m_shooterStateMgr != nullptr) { m_shooterStateMgr->RunCurrentState(); } }, 50.0);
+    m_loopScheduler->AddTask(std::string("indexer"), [this]() { if (m_indexerStateMgr != nullptr) { m_indexerStateMgr->RunCurrentState(); } }, 50.0);
+    m_loopScheduler->AddTask(std::string("climber"), 
+                             [this]() { if (m_climberStateMgr != nullptr) { m_climberStateMgr->RunCurrentState(); } }, 
+                             50.0, 
+                             10.0, 
+                             [this]() 
+                             { 
+                                 return m_climberStateMgr == nullptr || 
+                                        m_climberStateMgr->GetCurrentState() == ClimberStateMgr::CLIMBER_STATE::OFF ||
+                                        m_climberStateMgr->GetCurrentState() == ClimberStateMgr::CLIMBER_STATE::UNINITIALIZED;
+                             });
+    m_loopScheduler->AddTask(std::string("lift"), 
+                             [this]() { if (m_liftStateMgr != nullptr) { m_liftStateMgr->RunCurrentState(); } }, 
+                             50.0, 
+                             10.0, 
+                             [this]() 
+                             { 
+                                 // while shooting, the lift is off between balls and has to feed as soon as the shooter is ready
+                                 return m_liftStateMgr == nullptr || 
+                                        (m_liftStateMgr->GetCurrentState() == LiftStateMgr::LIFT_STATE::OFF && 
+                                         (m_shooterStateMgr == nullptr || !m_shooterStateMgr->IsShooting()));
+                             });
+    m_loopScheduler->AddTask(std::string("telemetry"), [this]() { m_loopScheduler->PublishStats(); }, 5.0);
+
+    // Check all of the auton files in the background (the state managers are needed to parse them).
+    // Skip it if the robot is already being enabled, so it doesn't compete with the match.
+    m_autonValidator = new AutonValidator();
+    m_initScheduler->AddStep(std::string("auton validation"), [this]() 
+    { 
+        if (frc::DriverStation::IsDisabled())
+        {
+            m_autonValidator->Start(); 
+        }
+        return true; 
+    });
 }
 
 /**
@@ -72,6 +142,10 @@ void Robot::RobotPeriodic()
  */
 void Robot::AutonomousInit() 
 {
+    if (m_initScheduler != nullptr)
+    {
+        m_initScheduler->RunAll();
+    }
     if (m_cyclePrims != nullptr)
     {
         m_cyclePrims->Init();
@@ -80,6 +154,10 @@ void Robot::AutonomousInit()
 
 void Robot::AutonomousPeriodic() 
 {
+    if (m_controller != nullptr)
+    {
+        m_controller->Update();
+    }
     if (m_cyclePrims != nullptr)
     {
         m_cyclePrims->Run();
@@ -88,7 +166,24 @@ void Robot::AutonomousPeriodic()
 
 void Robot::TeleopInit() 
 {
+    if (m_initScheduler != nullptr)
+    {
+        m_initScheduler->RunAll();
+    }
+    // in case the auton went straight to teleop without being disabled
+    if (m_cyclePrims != nullptr)
+    {
+        m_cyclePrims->DumpTimeline();
+    }
 
+    if (m_controller != nullptr)
+    {
+        m_controller->Update();
+    }
+    if (m_loopScheduler != nullptr)
+    {
+        m_loopScheduler->Reset();
+    }
     if (m_chassis != nullptr && m_controller != nullptr && m_swerve != nullptr)
     {
         m_swerve->Init();
@@ -122,50 +217,47 @@ void Robot::TeleopInit()
 
 void Robot::TeleopPeriodic() 
 {
-    if (m_chassis != nullptr && m_controller != nullptr && m_swerve != nullptr)
+    // read the controllers once so everything this loop sees the same inputs
+    if (m_controller != nullptr)
     {
-        m_swerve->Run();
+        m_controller->Update();
     }
 
-    if (m_leftIntakeStateMgr != nullptr)
+    if (m_loopScheduler != nullptr)
     {
-        m_leftIntakeStateMgr->RunCurrentState();
-    }
-    if (m_rightIntakeStateMgr != nullptr)
-    {
-        m_rightIntakeStateMgr->RunCurrentState();
-    }
-    if (m_shooterStateMgr != nullptr)
-    {
-        m_shooterStateMgr->RunCurrentState();
-    }
-    if (m_climberStateMgr != nullptr)
-    {
-        m_climberStateMgr->RunCurrentState();
-    }
-    if (m_indexerStateMgr != nullptr)
-    {
-        m_indexerStateMgr->RunCurrentState();
-    }
-    if (m_liftStateMgr != nullptr)
-    {
-        m_liftStateMgr->RunCurrentState();
+        m_loopScheduler->Run();
     }
 }
 
 void Robot::DisabledInit() 
 {
-
+    if (m_cyclePrims != nullptr)
+    {
+        m_cyclePrims->DumpTimeline();
+    }
+    StateTrace::GetInstance()->Dump();
 }
 
 void Robot::DisabledPeriodic() 
 {
+    if (m_initScheduler != nullptr && m_initScheduler->RunNext())
+    {
+        return;
+    }
 
+    // everything has been created, so the auton plan can be built in the background
+    if (m_cyclePrims != nullptr)
+    {
+        m_cyclePrims->UpdatePlan();
+    }
 }
 
 void Robot::TestInit() 
 {
-
+    if (m_initScheduler != nullptr)
+    {
+        m_initScheduler->RunAll();
+    }
 }
 
 void Robot::TestPeriodic() 
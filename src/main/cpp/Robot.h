@@ -8,6 +8,7 @@
 
 #include <frc/TimedRobot.h>
 
+#include <auton/AutonValidator.h>
 #include <auton/CyclePrimitives.h>
 #include <gamepad/TeleopControl.h>
 #include <states/chassis/SwerveDrive.h>
@@ -17,6 +18,9 @@
 #include <states/lift/LiftStateMgr.h>
 #include <states/shooter/ShooterStateMgr.h>
 #include <subsys/interfaces/IChassis.h>
+#include <utils/InitScheduler.h>
+#include <utils/LoopScheduler.h>
+#include <xmlhw/RobotDefn.h>
 
 
 
@@ -40,6 +44,10 @@ class Robot : public frc::TimedRobot
   CyclePrimitives*      m_cyclePrims;
   frc::Timer*           m_timer;
   SwerveDrive*          m_swerve;
+  RobotDefn*            m_robotDefn;
+  InitScheduler*        m_initScheduler;
+  LoopScheduler*        m_loopScheduler;
+  AutonValidator*       m_autonValidator;
 
   IntakeStateMgr*       m_leftIntakeStateMgr;
   IntakeStateMgr*       m_rightIntakeStateMgr;
@@ -0,0 +1,138 @@
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302 
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+// C++ Includes
+#include <cstddef>
+#include <vector>
+
+// FRC includes
+
+// Team 302 includes
+#include <auton/AutonProgram.h>
+#include <auton/PrimitiveEnums.h>
+#include <auton/PrimitiveFactory.h>
+#include <auton/PrimitiveParams.h>
+#include <auton/primitives/IPrimitive.h>
+
+// Third Party Includes
+
+using namespace std;
+
+AutonProgram::AutonProgram
+(
+    size_t      capacity
+) : m_params(),
+    m_primitives(),
+    m_steps(),
+    m_group(nullptr),
+    m_bound(false)
+{
+    m_params.reserve( capacity );
+    m_primitives.reserve( capacity );
+    m_steps.reserve( capacity + 1 );    // + 1 for an empty group
+}
+
+PrimitiveParams* AutonProgram::Add
+(
+    const PrimitiveParams&  params
+)
+{
+    if ( m_params.size() >= m_params.capacity() || 
+         ( m_group != nullptr && m_group->count >= MAX_GROUP_SIZE ) )
+    {
+        return nullptr;
+    }
+    if ( m_group != nullptr )
+    {
+        m_group->count++;
+    }
+    else
+    {
+        m_steps.emplace_back( Step{ SINGLE, m_params.size(), 1 } );
+    }
+    m_params.emplace_back( params );
+    m_bound = false;
+    return &m_params.back();
+}
+
+void AutonProgram::BeginGroup
+(
+    GROUP_TYPE  type
+)
+{
+    EndGroup();
+    m_steps.emplace_back( Step{ type, m_params.size(), 0 } );
+    m_group = &m_steps.back();
+}
+
+const AutonProgram::Step* AutonProgram::EndGroup()
+{
+    auto group = m_group;
+    m_group = nullptr;
+    if ( group != nullptr && group->count == 0 )
+    {
+        m_steps.pop_back();
+        group = nullptr;
+    }
+    return group;
+}
+
+const AutonProgram::Step* AutonProgram::GetStep
+(
+    size_t      step
+) const
+{
+    return step < m_steps.size() ? &m_steps[step] : nullptr;
+}
+
+bool AutonProgram::DrivesChassis
+(
+    PRIMITIVE_IDENTIFIER    id
+)
+{
+    return id != RUN_MECHANISMS && id != RESET_POSITION;
+}
+
+void AutonProgram::Bind()
+{
+    if ( m_bound )
+    {
+        return;
+    }
+
+    auto factory = PrimitiveFactory::GetInstance();
+    m_primitives.clear();
+    for ( auto& params : m_params )
+    {
+        m_primitives.emplace_back( factory->GetIPrimitive( &params ) );
+    }
+    m_bound = true;
+}
+
+PrimitiveParams* AutonProgram::GetParams
+(
+    size_t      slot
+)
+{
+    return slot < m_params.size() ? &m_params[slot] : nullptr;
+}
+
+IPrimitive* AutonProgram::GetPrimitive
+(
+    size_t      slot
+) const
+{
+    return ( m_bound && slot < m_primitives.size() ) ? m_primitives[slot] : nullptr;
+}
@@ -0,0 +1,141 @@
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302 
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+#pragma once
+
+// C++ Includes
+#include <cstddef>
+#include <vector>
+
+// FRC includes
+
+// Team 302 includes
+#include <auton/PrimitiveEnums.h>
+#include <auton/PrimitiveParams.h>
+
+// Third Party Includes
+
+class IPrimitive;
+
+/// @class AutonProgram
+/// @brief A compiled auton:  the primitive parameters live in one contiguous block that is sized
+///        when the auton file is parsed and never grows, and each slot is bound to its primitive
+///        instance before the match.  Running (or re-running) the program only walks the arrays;
+///        the program owns its parameters, so replacing it frees the old auton.
+///
+///        The program runs as a list of steps.  A step is either a single primitive or a group of
+///        consecutive primitives that run at the same time:  a parallel group ends when all of its
+///        primitives are done, a race group when any of them is done and a deadline group when its
+///        first primitive is done.
+class AutonProgram
+{
+    public:
+        enum GROUP_TYPE
+        {
+            SINGLE,
+            PARALLEL,
+            RACE,
+            DEADLINE
+        };
+
+        struct Step
+        {
+            GROUP_TYPE  type;
+            size_t      first;      // slot of the first primitive
+            size_t      count;      // number of primitives
+        };
+
+        /// @brief  Most primitives in a group
+        static constexpr size_t MAX_GROUP_SIZE = 16;
+
+        /// @brief  Create an empty program
+        /// @param [in] size_t capacity - maximum number of primitives (the storage is reserved once)
+        explicit AutonProgram
+        (
+            size_t      capacity
+        );
+        ~AutonProgram() = default;
+
+        AutonProgram() = delete;
+        AutonProgram(const AutonProgram&) = delete;
+        AutonProgram& operator=(const AutonProgram&) = delete;
+
+        /// @brief  Append a primitive
+        /// @param [in] const PrimitiveParams& params - primitive to copy into the program
+        /// @return PrimitiveParams* - the stored primitive (nullptr if the program is full)
+        PrimitiveParams* Add
+        (
+            const PrimitiveParams&  params
+        );
+
+        /// @brief  Primitives added until EndGroup run together as one step
+        void BeginGroup
+        (
+            GROUP_TYPE  type
+        );
+
+        /// @brief  Close the group started by BeginGroup (an empty group is dropped)
+        /// @return const Step* - the group (nullptr if it was empty)
+        const Step* EndGroup();
+
+        /// @brief  Bind each slot to its primitive instance from the PrimitiveFactory.  Call from the
+        ///         robot thread (the factory isn't thread safe); does nothing once bound.
+        void Bind();
+
+        /// @brief  Have the primitives been bound
+        bool IsBound() const { return m_bound; }
+
+        size_t Size() const { return m_params.size(); }
+        bool Empty() const { return m_params.empty(); }
+
+        size_t StepCount() const { return m_steps.size(); }
+
+        /// @brief  Step to run
+        /// @return const Step* - step (nullptr if out of range)
+        const Step* GetStep
+        (
+            size_t      step
+        ) const;
+
+        /// @brief  Parameters for a slot
+        /// @return PrimitiveParams* - parameters (nullptr if the slot is out of range)
+        PrimitiveParams* GetParams
+        (
+            size_t      slot
+        );
+
+        /// @brief  Primitive instance for a slot (Bind must have been called)
+        /// @return IPrimitive* - primitive (nullptr if the slot is out of range or unbound)
+        IPrimitive* GetPrimitive
+        (
+            size_t      slot
+        ) const;
+
+        /// @brief  Does the primitive command the chassis (a step can only have one that does)
+        static bool DrivesChassis
+        (
+            PRIMITIVE_IDENTIFIER    id
+        );
+
+        std::vector<PrimitiveParams>::const_iterator begin() const { return m_params.begin(); }
+        std::vector<PrimitiveParams>::const_iterator end() const { return m_params.end(); }
+
+    private:
+        std::vector<PrimitiveParams>    m_params;       // reserved in the constructor, so pointers stay valid
+        std::vector<IPrimitive*>        m_primitives;   // parallel to m_params
+        std::vector<Step>               m_steps;        // reserved in the constructor too
+        Step*                           m_group;        // group being added to (nullptr if none)
+        bool                            m_bound;
+};
@@ -64,6 +64,18 @@ std::string AutonSelector::GetSelectedAutoFile()
 //---------------------------------------------------------------------
 void AutonSelector::FindXMLFileNames()
 {
+	m_xmlFiles = GetAutonFileNames();
+}
+
+//---------------------------------------------------------------------
+// Method: 		GetAutonFileNames
+// Description: This returns the auton XML files in the deploy/auton
+//				directory.
+// Returns:		std::vector<std::string>	auton files
+//---------------------------------------------------------------------
+vector<string> AutonSelector::GetAutonFileNames()
+{
+	vector<string> xmlFiles;
 #ifdef __linux__
 	//struct dirent* files;
 
@@ -85,11 +97,12 @@ void AutonSelector::FindXMLFileNames()
 				auto filename = string( files->d_name);
 				if ( filename != "." && filename != ".." && filename != "auton.dtd" )
 				{
-					m_xmlFiles.emplace_back(string(files->d_name));
+					xmlFiles.emplace_back(string(files->d_name));
 				}
 
 			} 
 		}
+		closedir(directory);
 	}
 	else
 	{
@@ -97,6 +110,7 @@ void AutonSelector::FindXMLFileNames()
 	}
 #endif
 // TODO handle windows so the simulator works
+	return xmlFiles;
 }
 
 //---------------------------------------------------------------------
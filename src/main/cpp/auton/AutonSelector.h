@@ -45,6 +45,14 @@ class AutonSelector
 		//---------------------------------------------------------------------
 		std::string GetSelectedAutoFile();
 
+		//---------------------------------------------------------------------
+		// Method: 		GetAutonFileNames
+		// Description: This returns the auton XML files in the deploy/auton
+		//				directory.
+		// Returns:		std::vector<std::string>	auton files
+		//---------------------------------------------------------------------
+		static std::vector<std::string> GetAutonFileNames();
+
 	private:
 
 		//---------------------------------------------------------------------
@@ -0,0 +1,190 @@
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302 
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+// C++ Includes
+#include <cstdio>
+#include <string>
+
+// FRC includes
+#include <frc/geometry/Pose2d.h>
+
+// Team 302 includes
+#include <auton/AutonProgram.h>
+#include <auton/AutonTimeline.h>
+#include <auton/PrimitiveEnums.h>
+#include <auton/PrimitiveParams.h>
+#include <utils/Logger.h>
+
+// Third Party Includes
+
+using namespace frc;
+using namespace std;
+
+namespace
+{
+    const char* PrimitiveName
+    (
+        PRIMITIVE_IDENTIFIER    id
+    )
+    {
+        static const char* names[MAX_AUTON_PRIMITIVES] = 
+        {
+            "DO_NOTHING",
+            "HOLD_POSITION",
+            "DRIVE_DISTANCE",
+            "DRIVE_TIME",
+            "DRIVE_TO_WALL",
+            "TURN_ANGLE_ABS",
+            "TURN_ANGLE_REL",
+            "DRIVE_PATH",
+            "RESET_POSITION",
+            "DRIVE_TO_POSE",
+            "RUN_MECHANISMS"
+        };
+        return (id > UNKNOWN_PRIMITIVE && id < MAX_AUTON_PRIMITIVES) ? names[id] : "UNKNOWN";
+    }
+}
+
+AutonTimeline::AutonTimeline() : m_entries(),
+                                 m_count(0),
+                                 m_firstRunning(0),
+                                 m_running(0),
+                                 m_dumped(true)
+{
+}
+
+void AutonTimeline::Clear()
+{
+    m_count = 0;
+    m_firstRunning = 0;
+    m_running = 0;
+    m_dumped = true;
+}
+
+size_t AutonTimeline::Start
+(
+    size_t                  slot,
+    PRIMITIVE_IDENTIFIER    id,
+    double                  budget,
+    double                  time,
+    const Pose2d&           pose
+)
+{
+    auto handle = m_count < MAX_ENTRIES ? m_count : NOT_RECORDED;
+    if ( handle != NOT_RECORDED )
+    {
+        m_entries[handle] = Entry{ slot, id, budget, time, 0.0, 0.0, nullptr, pose, pose };
+        if ( m_running == 0 )
+        {
+            m_firstRunning = handle;
+        }
+        m_running++;
+    }
+    m_count++;
+    m_dumped = false;
+    return handle;
+}
+
+void AutonTimeline::RecordLoop
+(
+    double                  loopTime
+)
+{
+    for ( auto inx=m_firstRunning; m_running > 0 && inx<Size(); ++inx )
+    {
+        auto& entry = m_entries[inx];
+        if ( entry.reason == nullptr && loopTime > entry.maxLoop )
+        {
+            entry.maxLoop = loopTime;
+        }
+    }
+}
+
+void AutonTimeline::End
+(
+    size_t                  handle,
+    const char*             reason,
+    double                  time,
+    const Pose2d&           pose
+)
+{
+    if ( handle < Size() && m_entries[handle].reason == nullptr )
+    {
+        auto& entry = m_entries[handle];
+        entry.end = time;
+        entry.endPose = pose;
+        // primitives that don't say why they ended either ran out of time or finished
+        entry.reason = reason != nullptr ? reason : 
+                       (entry.budget > 0.0 && time - entry.start >= entry.budget) ? "time" : "done";
+        m_running--;
+    }
+}
+
+void AutonTimeline::EndAll
+(
+    const char*             reason,
+    double                  time,
+    const Pose2d&           pose
+)
+{
+    for ( auto inx=m_firstRunning; m_running > 0 && inx<Size(); ++inx )
+    {
+        End( inx, reason, time, pose );
+    }
+}
+
+void AutonTimeline::Dump
+(
+    const AutonProgram*     program
+)
+{
+    if ( m_dumped )
+    {
+        return;
+    }
+    m_dumped = true;
+
+    auto logger = Logger::GetLogger();
+    string ntName("Auton Timeline");
+    logger->ToNtTable(ntName, string("Primitives"), static_cast<double>(m_count));
+
+    auto autonStart = m_count > 0 ? m_entries[0].start : 0.0;
+    char line[256];
+    for ( size_t inx=0; inx<Size(); ++inx )
+    {
+        auto& entry = m_entries[inx];
+        auto params = program != nullptr ? program->GetParams(entry.slot) : nullptr;
+        auto running = entry.reason == nullptr;  // dumped while the auton was still running
+        snprintf( line, sizeof(line), 
+                  "%zu %s %s start %.3f ran %.3f/%.3f s max loop %.1f ms ended (%s) from (%.2f, %.2f, %.0f) to (%.2f, %.2f, %.0f)",
+                  entry.slot, 
+                  PrimitiveName(entry.id), 
+                  (params != nullptr) ? params->GetPathName().c_str() : "",
+                  entry.start - autonStart, 
+                  running ? 0.0 : entry.end - entry.start, 
+                  entry.budget,
+                  entry.maxLoop * 1000.0,
+                  running ? "auton ended" : entry.reason,
+                  entry.startPose.X().to<double>(), entry.startPose.Y().to<double>(), entry.startPose.Rotation().Degrees().to<double>(),
+                  entry.endPose.X().to<double>(), entry.endPose.Y().to<double>(), entry.endPose.Rotation().Degrees().to<double>() );
+        logger->LogError( Logger::LOGGER_LEVEL::PRINT, string("AutonTimeline"), string(line) );
+        logger->ToNtTable( ntName, to_string(inx), string(line) );
+    }
+    if ( m_count > MAX_ENTRIES )
+    {
+        logger->LogError( Logger::LOGGER_LEVEL::WARNING, string("AutonTimeline"), 
+                          to_string(m_count - MAX_ENTRIES) + string(" primitives weren't recorded") );
+    }
+}
@@ -0,0 +1,119 @@
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302 
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+#pragma once
+
+// C++ Includes
+#include <array>
+#include <string>
+
+// FRC includes
+#include <frc/geometry/Pose2d.h>
+
+// Team 302 includes
+#include <auton/PrimitiveEnums.h>
+
+// Third Party Includes
+
+class AutonProgram;
+
+/// @class AutonTimeline
+/// @brief Records when each auton primitive started and ended, why it ended, the longest loop while it
+///        ran and the robot pose at each transition.  The entries are in a fixed buffer, so recording
+///        doesn't allocate while the auton runs;  Dump writes them out once the auton is over.
+class AutonTimeline
+{
+    public:
+        /// @brief  Most primitives recorded for one auton (any after this are counted, but not recorded)
+        static constexpr size_t MAX_ENTRIES = 32;
+
+        /// @brief  Handle returned by Start when the buffer is full
+        static constexpr size_t NOT_RECORDED = MAX_ENTRIES;
+
+        struct Entry
+        {
+            size_t                  slot;           // slot in the auton
+            PRIMITIVE_IDENTIFIER    id;
+            double                  budget;         // time from the XML in seconds (0.0 if none)
+            double                  start;          // FPGA time in seconds
+            double                  end;            // FPGA time in seconds (0.0 while running)
+            double                  maxLoop;        // longest loop in seconds
+            const char*             reason;         // why it ended (nullptr while running)
+            frc::Pose2d             startPose;
+            frc::Pose2d             endPose;
+        };
+
+        AutonTimeline();
+        ~AutonTimeline() = default;
+
+        /// @brief  Forget the previous auton
+        void Clear();
+
+        /// @brief  A primitive is starting (primitives in a group run at the same time)
+        /// @return size_t - handle to end it with (NOT_RECORDED if the buffer is full)
+        size_t Start
+        (
+            size_t                  slot,
+            PRIMITIVE_IDENTIFIER    id,
+            double                  budget,
+            double                  time,
+            const frc::Pose2d&      pose
+        );
+
+        /// @brief  Record how long a loop of the running primitives took
+        /// @param [in] double loopTime - seconds
+        void RecordLoop
+        (
+            double                  loopTime
+        );
+
+        /// @brief  A primitive ended
+        /// @param [in] size_t handle - from Start
+        /// @param [in] const char* reason - string literal (the primitive's reason, if it gave one)
+        void End
+        (
+            size_t                  handle,
+            const char*             reason,
+            double                  time,
+            const frc::Pose2d&      pose
+        );
+
+        /// @brief  End all of the running primitives
+        void EndAll
+        (
+            const char*             reason,
+            double                  time,
+            const frc::Pose2d&      pose
+        );
+
+        /// @brief  Write the timeline to the log and the "Auton Timeline" network table.  Does nothing
+        ///         if there is nothing new to write.
+        /// @param [in] const AutonProgram* program - program that ran (for the path names, may be nullptr)
+        void Dump
+        (
+            const AutonProgram*     program
+        );
+
+        size_t Size() const { return m_count < MAX_ENTRIES ? m_count : MAX_ENTRIES; }
+        const Entry& GetEntry(size_t inx) const { return m_entries[inx]; }
+        bool IsRunning() const { return m_running > 0; }
+
+    private:
+        std::array<Entry, MAX_ENTRIES>  m_entries;
+        size_t                          m_count;        // primitives started (may be more than MAX_ENTRIES)
+        size_t                          m_firstRunning; // entries before this have ended
+        size_t                          m_running;      // number of entries running
+        bool                            m_dumped;
+};
@@ -0,0 +1,118 @@
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302 
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+// C++ Includes
+#include <chrono>
+#include <future>
+#include <string>
+#include <vector>
+
+// FRC includes
+
+// Team 302 includes
+#include <auton/AutonProgram.h>
+#include <auton/AutonSelector.h>
+#include <auton/AutonValidator.h>
+#include <auton/PrimitiveEnums.h>
+#include <auton/PrimitiveParams.h>
+#include <auton/PrimitiveParser.h>
+#include <auton/TrajectoryCache.h>
+#include <utils/Logger.h>
+
+// Third Party Includes
+
+using namespace std;
+
+AutonValidator::AutonValidator() : m_validation()
+{
+}
+
+void AutonValidator::Start()
+{
+    if ( !m_validation.valid() )
+    {
+        m_validation = async( launch::async, &AutonValidator::ValidateAll );
+    }
+}
+
+bool AutonValidator::IsDone() const
+{
+    return m_validation.valid() && m_validation.wait_for(chrono::seconds(0)) == future_status::ready;
+}
+
+vector<string> AutonValidator::Validate
+(
+    const string&   fileName
+)
+{
+    vector<string> errors;
+    auto program = PrimitiveParser::ParseXML( fileName, &errors, false );
+    if ( program->Empty() && errors.empty() )
+    {
+        errors.emplace_back( string("no primitives") );
+    }
+
+    auto slot = 0;
+    for ( auto& param : *program )
+    {
+        slot++;
+        auto path = param.GetPathName();
+        if ( !path.empty() )
+        {
+            auto primitive = string("primitive ") + to_string(slot) + string(" ");
+            if ( !TrajectoryCache::GetInstance()->Load( path ) )
+            {
+                errors.emplace_back( primitive + string("can't load path ") + path );
+            }
+            else if ( param.GetID() == DRIVE_PATH )
+            {
+                auto duration = TrajectoryCache::GetInstance()->GetTrajectory( path ).get()->TotalTime().to<double>();
+                if ( param.GetTime() > 0.0 && duration > param.GetTime() )
+                {
+                    errors.emplace_back( primitive + path + string(" takes ") + to_string(duration) + 
+                                         string(" s but the time limit is ") + to_string(param.GetTime()) + string(" s") );
+                }
+            }
+        }
+    }
+    return errors;
+}
+
+void AutonValidator::ValidateAll()
+{
+    auto ntName = string("AutonValidation");
+    auto files = AutonSelector::GetAutonFileNames();
+    auto bad = 0;
+    for ( auto& file : files )
+    {
+        auto errors = Validate( file );
+        if ( errors.empty() )
+        {
+            Logger::GetLogger()->ToNtTable( ntName, file, string("OK") );
+        }
+        else
+        {
+            bad++;
+            string msg;
+            for ( auto& error : errors )
+            {
+                msg += msg.empty() ? error : string("; ") + error;
+            }
+            Logger::GetLogger()->ToNtTable( ntName, file, msg );
+            Logger::GetLogger()->LogError( Logger::LOGGER_LEVEL::WARNING, string("AutonValidator ") + file, msg );
+        }
+    }
+    Logger::GetLogger()->ToNtTable( ntName, string("Summary"), to_string(files.size()) + string(" autons, ") + to_string(bad) + string(" with problems") );
+}
@@ -0,0 +1,60 @@
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302 
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+#pragma once
+
+// C++ Includes
+#include <future>
+#include <string>
+#include <vector>
+
+// FRC includes
+
+// Team 302 includes
+
+// Third Party Includes
+
+
+/// @class AutonValidator
+/// @brief Checks every auton file in deploy/auton on a background thread: the XML must parse, every
+///        pathname must load, and a path that takes longer than its primitive's time limit is
+///        flagged.  The results are written to the "AutonValidation" network table per auton, so
+///        problems show up on the dashboard at boot instead of in AutonomousInit.  The trajectories
+///        are left in the TrajectoryCache.
+class AutonValidator
+{
+    public:
+        AutonValidator();
+        ~AutonValidator() = default;
+
+        /// @brief  Start validating on a background thread (does nothing if it was already started)
+        void Start();
+
+        /// @brief  Has the validation finished
+        bool IsDone() const;
+
+        /// @brief  Validate one auton file
+        /// @param [in] const std::string& fileName - auton file in deploy/auton
+        /// @return std::vector<std::string> - problems found (empty if the auton is good)
+        static std::vector<std::string> Validate
+        (
+            const std::string&      fileName
+        );
+
+    private:
+        static void ValidateAll();
+
+        std::future<void>       m_validation;
+};
@@ -0,0 +1,325 @@
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302 
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+// C++ Includes
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#ifdef __linux__
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// FRC includes
+#include <frc/geometry/Pose2d.h>
+#include <frc/geometry/Rotation2d.h>
+#include <frc/trajectory/Trajectory.h>
+
+// Team 302 includes
+#include <auton/BinaryTrajectory.h>
+#include <utils/Logger.h>
+
+// Third Party Includes
+
+using namespace std;
+
+static_assert(sizeof(BinaryTrajectoryHeader) == 32, "binary trajectory header layout changed");
+static_assert(sizeof(BinaryTrajectoryState) == 64, "binary trajectory state layout changed");
+
+namespace
+{
+    constexpr array<uint32_t, 256> MakeCrcTable()
+    {
+        array<uint32_t, 256> table{};
+        for ( uint32_t inx=0; inx<256; ++inx )
+        {
+            auto crc = inx;
+            for ( auto bit=0; bit<8; ++bit )
+            {
+                crc = (crc & 1) ? (0xEDB88320U ^ (crc >> 1)) : (crc >> 1);
+            }
+            table[inx] = crc;
+        }
+        return table;
+    }
+    constexpr auto crcTable = MakeCrcTable();
+}
+
+BinaryTrajectory::BinaryTrajectory() : m_map(nullptr),
+                                       m_mapSize(0),
+                                       m_owned(),
+                                       m_states(nullptr),
+                                       m_count(0),
+                                       m_holonomic(false)
+{
+}
+
+BinaryTrajectory::~BinaryTrajectory()
+{
+#ifdef __linux__
+    if ( m_map != nullptr )
+    {
+        munmap(m_map, m_mapSize);
+    }
+#endif
+}
+
+shared_ptr<const BinaryTrajectory> BinaryTrajectory::Load
+(
+    const string&       binaryFile,
+    const string&       sourceFile
+)
+{
+    shared_ptr<BinaryTrajectory> trajectory(new BinaryTrajectory());
+    const unsigned char* data = nullptr;
+    size_t size = 0;
+
+#ifdef __linux__
+    auto fd = open(binaryFile.c_str(), O_RDONLY);
+    if ( fd < 0 )
+    {
+        return nullptr;
+    }
+    struct stat info;
+    if ( fstat(fd, &info) == 0 && info.st_size >= static_cast<off_t>(sizeof(BinaryTrajectoryHeader)) )
+    {
+        size = static_cast<size_t>(info.st_size);
+        auto map = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if ( map != MAP_FAILED )
+        {
+            trajectory->m_map = map;
+            trajectory->m_mapSize = size;
+            data = static_cast<const unsigned char*>(map);
+        }
+    }
+    close(fd);
+#else
+    // no mmap, so read the file into the owned states
+    ifstream file(binaryFile, ios::binary | ios::ate);
+    if ( file.good() && file.tellg() >= static_cast<streamoff>(sizeof(BinaryTrajectoryHeader)) )
+    {
+        size = static_cast<size_t>(file.tellg());
+        BinaryTrajectoryHeader header;
+        file.seekg(0);
+        file.read(reinterpret_cast<char*>(&header), sizeof(header));
+        // enough states to hold the whole file (the header is smaller than a state)
+        trajectory->m_owned.resize((size + sizeof(BinaryTrajectoryState) - 1) / sizeof(BinaryTrajectoryState));
+        memcpy(trajectory->m_owned.data(), &header, sizeof(header));
+        file.read(reinterpret_cast<char*>(trajectory->m_owned.data()) + sizeof(header), size - sizeof(header));
+        data = reinterpret_cast<const unsigned char*>(trajectory->m_owned.data());
+    }
+#endif
+
+    if ( data == nullptr )
+    {
+        return nullptr;
+    }
+
+    auto header = reinterpret_cast<const BinaryTrajectoryHeader*>(data);
+    string error;
+    if ( memcmp(header->magic, "T302", 4) != 0 || header->version != VERSION || header->stateSize != sizeof(BinaryTrajectoryState) )
+    {
+        error = string(" has the wrong format or version");
+    }
+    else if ( sizeof(BinaryTrajectoryHeader) + static_cast<size_t>(header->stateCount) * sizeof(BinaryTrajectoryState) > size )
+    {
+        error = string(" is truncated");
+    }
+    else if ( Crc32(data + sizeof(BinaryTrajectoryHeader), header->stateCount * sizeof(BinaryTrajectoryState)) != header->payloadCrc )
+    {
+        error = string(" failed the checksum");
+    }
+    else
+    {
+        // convertTrajectories re-converts whenever a JSON changes and deploy depends on it, so the 
+        // source CRC is checked at build time;  here only compare the JSON's size (if it is there), 
+        // which doesn't read the file
+        if ( IsStale(sourceFile, header->sourceSize) )
+        {
+            error = string(" is stale (re-run convertTrajectories)");
+        }
+    }
+
+    if ( !error.empty() )
+    {
+        Logger::GetLogger()->LogError(Logger::LOGGER_LEVEL::WARNING, string("BinaryTrajectory::Load"), binaryFile + error);
+        return nullptr;
+    }
+
+    trajectory->m_states = reinterpret_cast<const BinaryTrajectoryState*>(data + sizeof(BinaryTrajectoryHeader));
+    trajectory->m_count = header->stateCount;
+    trajectory->m_holonomic = (header->flags & FLAG_HOLONOMIC) != 0;
+    return trajectory;
+}
+
+shared_ptr<const BinaryTrajectory> BinaryTrajectory::FromTrajectory
+(
+    const frc::Trajectory&  trajectory
+)
+{
+    shared_ptr<BinaryTrajectory> binary(new BinaryTrajectory());
+    auto& states = trajectory.States();
+    binary->m_owned.reserve(states.size());
+    for ( auto& state : states )
+    {
+        binary->m_owned.emplace_back(BinaryTrajectoryState{ state.t.to<double>(),
+                                                            state.velocity.to<double>(),
+                                                            state.acceleration.to<double>(),
+                                                            state.pose.X().to<double>(),
+                                                            state.pose.Y().to<double>(),
+                                                            state.pose.Rotation().Radians().to<double>(),
+                                                            state.curvature.to<double>(),
+                                                            state.pose.Rotation().Radians().to<double>() });
+    }
+    binary->m_states = binary->m_owned.data();
+    binary->m_count = binary->m_owned.size();
+    return binary;
+}
+
+shared_ptr<const BinaryTrajectory> BinaryTrajectory::FromStates
+(
+    vector<BinaryTrajectoryState>   states,
+    bool                            holonomic
+)
+{
+    shared_ptr<BinaryTrajectory> binary(new BinaryTrajectory());
+    binary->m_owned = move(states);
+    binary->m_states = binary->m_owned.data();
+    binary->m_count = binary->m_owned.size();
+    binary->m_holonomic = holonomic;
+    return binary;
+}
+
+bool BinaryTrajectory::IsStale
+(
+    const string&       sourceFile,
+    uint32_t            sourceSize
+)
+{
+#ifdef __linux__
+    struct stat info;
+    return stat(sourceFile.c_str(), &info) == 0 && static_cast<uint64_t>(info.st_size) != sourceSize;
+#else
+    ifstream source(sourceFile, ios::binary | ios::ate);
+    return source.good() && static_cast<uint64_t>(source.tellg()) != sourceSize;
+#endif
+}
+
+uint32_t BinaryTrajectory::Crc32
+(
+    const void*     data,
+    size_t          size
+)
+{
+    auto bytes = static_cast<const unsigned char*>(data);
+    uint32_t crc = 0xFFFFFFFFU;
+    for ( size_t inx=0; inx<size; ++inx )
+    {
+        crc = crcTable[(crc ^ bytes[inx]) & 0xFF] ^ (crc >> 8);
+    }
+    return crc ^ 0xFFFFFFFFU;
+}
+
+units::second_t BinaryTrajectory::TotalTime() const
+{
+    return units::second_t(m_count > 0 ? m_states[m_count-1].time : 0.0);
+}
+
+frc::Pose2d BinaryTrajectory::InitialPose() const
+{
+    return m_count > 0 ? ToState(m_states[0]).pose : frc::Pose2d();
+}
+
+frc::Trajectory::State BinaryTrajectory::Sample
+(
+    units::second_t     t
+) const
+{
+    if ( m_count == 0 )
+    {
+        return frc::Trajectory::State();
+    }
+
+    auto time = t.to<double>();
+    if ( time <= m_states[0].time )
+    {
+        return ToState(m_states[0]);
+    }
+    if ( time >= m_states[m_count-1].time )
+    {
+        return ToState(m_states[m_count-1]);
+    }
+
+    // first state after the time; the one before it is the start of the interval
+    auto next = upper_bound(m_states, m_states+m_count, time, 
+                            [](double value, const BinaryTrajectoryState& state) { return value < state.time; });
+    return Interpolate(static_cast<size_t>(next - m_states) - 1, time);
+}
+
+frc::Trajectory::State BinaryTrajectory::Interpolate
+(
+    size_t      index,
+    double      time
+) const
+{
+    auto& prev = m_states[index];
+    auto& next = m_states[index+1];
+    auto dt = next.time - prev.time;
+    auto fraction = dt > 0.0 ? (time - prev.time) / dt : 0.0;
+    return ToState(prev).Interpolate(ToState(next), fraction);
+}
+
+frc::Rotation2d BinaryTrajectory::InterpolateHolonomicRotation
+(
+    size_t      index,
+    double      time
+) const
+{
+    auto& prev = m_states[index];
+    frc::Rotation2d start{units::radian_t(prev.holonomicRotation)};
+    if ( index + 1 >= m_count )
+    {
+        return start;
+    }
+
+    auto& next = m_states[index+1];
+    auto dt = next.time - prev.time;
+    auto fraction = dt > 0.0 ? std::clamp((time - prev.time) / dt, 0.0, 1.0) : 0.0;
+
+    // Rotation2d subtraction wraps, so this turns the short way
+    auto delta = frc::Rotation2d(units::radian_t(next.holonomicRotation)) - start;
+    return start + frc::Rotation2d(delta.Radians() * fraction);
+}
+
+frc::Trajectory::State BinaryTrajectory::ToState
+(
+    const BinaryTrajectoryState&    state
+)
+{
+    frc::Trajectory::State out;
+    out.t = units::second_t(state.time);
+    out.velocity = units::meters_per_second_t(state.velocity);
+    out.acceleration = units::meters_per_second_squared_t(state.acceleration);
+    out.pose = frc::Pose2d(units::meter_t(state.x), units::meter_t(state.y), frc::Rotation2d(units::radian_t(state.rotation)));
+    out.curvature = units::curvature_t(state.curvature);
+    return out;
+}
@@ -0,0 +1,173 @@
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302 
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+#pragma once
+
+// C++ Includes
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+// FRC includes
+#include <frc/geometry/Pose2d.h>
+#include <frc/geometry/Rotation2d.h>
+#include <frc/trajectory/Trajectory.h>
+#include <units/time.h>
+
+// Team 302 includes
+
+// Third Party Includes
+
+
+/// @brief  Fixed header at the start of a binary trajectory (.traj) file.  The file is written by the
+///         convertTrajectories gradle task (build.gradle); keep the two in sync and bump the version
+///         if the layout changes.  All values are little-endian.
+struct BinaryTrajectoryHeader
+{
+    char        magic[4];       // "T302"
+    uint32_t    version;        // BinaryTrajectory::VERSION
+    uint32_t    stateCount;     // number of BinaryTrajectoryStates that follow the header
+    uint32_t    stateSize;      // sizeof(BinaryTrajectoryState)
+    uint32_t    sourceSize;     // size of the JSON file that was converted (bytes)
+    uint32_t    sourceCrc;      // CRC-32 of the JSON file that was converted (not checked on the robot)
+    uint32_t    payloadCrc;     // CRC-32 of the states
+    uint32_t    flags;          // BinaryTrajectory::FLAG_xxx
+};
+
+/// @brief  One trajectory state in a binary trajectory file (SI units, the frc::Trajectory::State fields plus
+///         the holonomic rotation target)
+struct BinaryTrajectoryState
+{
+    double      time;           // seconds
+    double      velocity;       // meters per second
+    double      acceleration;   // meters per second squared
+    double      x;              // meters
+    double      y;              // meters
+    double      rotation;       // radians
+    double      curvature;      // radians per meter
+    double      holonomicRotation;  // radians; robot heading target (same as rotation if the source has none)
+};
+
+/// @class BinaryTrajectory
+/// @brief Read-only trajectory whose states are memory-mapped from a binary trajectory file, so
+///        loading doesn't parse or allocate per state.  A trajectory can also be built from an
+///        frc::Trajectory (e.g. when only the JSON is available), in which case it owns the states.
+class BinaryTrajectory
+{
+    public:
+        static constexpr uint32_t   VERSION = 2;
+        static constexpr uint32_t   FLAG_HOLONOMIC = 1;    // the states have holonomic rotation targets
+
+        ~BinaryTrajectory();
+        BinaryTrajectory(const BinaryTrajectory&) = delete;
+        BinaryTrajectory& operator=(const BinaryTrajectory&) = delete;
+
+        /// @brief  Map a binary trajectory file
+        /// @param [in] const std::string& binaryFile - .traj file to map
+        /// @param [in] const std::string& sourceFile - JSON file it was converted from (its size is checked
+        ///                                             against the header if it is present;  the build
+        ///                                             re-converts it when its contents change)
+        /// @return std::shared_ptr<const BinaryTrajectory> - nullptr if the file is missing, has the wrong
+        ///                                                   version, fails the checksum or is stale
+        static std::shared_ptr<const BinaryTrajectory> Load
+        (
+            const std::string&      binaryFile,
+            const std::string&      sourceFile
+        );
+
+        /// @brief  Build a trajectory that owns a copy of the frc::Trajectory states
+        static std::shared_ptr<const BinaryTrajectory> FromTrajectory
+        (
+            const frc::Trajectory&  trajectory
+        );
+
+        /// @brief  Build a trajectory that owns already computed states (e.g. a generated PathPlanner path)
+        /// @param [in] std::vector<BinaryTrajectoryState> states - states in time order
+        /// @param [in] bool holonomic - the states have holonomic rotation targets
+        static std::shared_ptr<const BinaryTrajectory> FromStates
+        (
+            std::vector<BinaryTrajectoryState>  states,
+            bool                                holonomic
+        );
+
+        /// @brief  CRC-32 (same polynomial as java.util.zip.CRC32)
+        static uint32_t Crc32
+        (
+            const void*     data,
+            size_t          size
+        );
+
+        size_t Size() const { return m_count; }
+        bool Empty() const { return m_count == 0; }
+        bool IsHolonomic() const { return m_holonomic; }
+        const BinaryTrajectoryState* States() const { return m_states; }
+        const BinaryTrajectoryState& GetState(size_t index) const { return m_states[index]; }
+
+        units::second_t TotalTime() const;
+        frc::Pose2d InitialPose() const;
+
+        /// @brief  Interpolated state at a time
+        /// @param [in] units::second_t t - time from the start of the trajectory
+        /// @return frc::Trajectory::State - state at that time (clamped to the ends)
+        frc::Trajectory::State Sample
+        (
+            units::second_t         t
+        ) const;
+
+        /// @brief  Interpolated state between a state and the one after it
+        /// @param [in] size_t index - state at the start of the interval (must be less than Size()-1)
+        /// @param [in] double time - time in seconds within the interval
+        /// @return frc::Trajectory::State - interpolated state
+        frc::Trajectory::State Interpolate
+        (
+            size_t                  index,
+            double                  time
+        ) const;
+
+        /// @brief  Interpolated holonomic rotation target between a state and the one after it
+        /// @param [in] size_t index - state at the start of the interval (the last state returns its own target)
+        /// @param [in] double time - time in seconds within the interval
+        /// @return frc::Rotation2d - heading the robot should have
+        frc::Rotation2d InterpolateHolonomicRotation
+        (
+            size_t                  index,
+            double                  time
+        ) const;
+
+        /// @brief  Convert a stored state
+        static frc::Trajectory::State ToState
+        (
+            const BinaryTrajectoryState&    state
+        );
+
+    private:
+        BinaryTrajectory();
+
+        /// @brief  Is the JSON there with a different size than the one that was converted
+        static bool IsStale
+        (
+            const std::string&      sourceFile,
+            uint32_t                sourceSize
+        );
+
+        void*                               m_map;          // mapped file (nullptr if the states are owned)
+        size_t                              m_mapSize;
+        std::vector<BinaryTrajectoryState>  m_owned;        // states when built from an frc::Trajectory or read without mmap
+        const BinaryTrajectoryState*        m_states;
+        size_t                              m_count;
+        bool                                m_holonomic;
+};
@@ -15,29 +15,41 @@
 //====================================================================================================================================================
 
 // C++ Includes
+#include <algorithm>
+#include <chrono>
+#include <future>
 #include <memory>
 #include <string>
 
 // FRC includes
 #include <frc/DriverStation.h>
+#include <frc/TimedRobot.h>
 #include <frc/Timer.h>
+#include <frc/geometry/Pose2d.h>
+#include <frc/kinematics/ChassisSpeeds.h>
 
 // Team 302 includes
+#include <auton/AutonProgram.h>
 #include <auton/AutonSelector.h>
+#include <auton/AutonTimeline.h>
 #include <auton/CyclePrimitives.h>
 #include <auton/PrimitiveEnums.h>
 #include <auton/PrimitiveFactory.h>
 #include <auton/PrimitiveParams.h>
 #include <auton/PrimitiveParser.h>
+#include <auton/TrajectoryCache.h>
 #include <auton/primitives/IPrimitive.h>
 #include <states/indexer/IndexerStateMgr.h>
 #include <states/intake/LeftIntakeStateMgr.h>
 #include <states/intake/RightIntakeStateMgr.h>
 #include <states/lift/LiftStateMgr.h>
 #include <states/shooter/ShooterStateMgr.h>
+#include <states/StateTrace.h>
+#include <subsys/ChassisFactory.h>
 #include <subsys/Intake.h>
 #include <subsys/MechanismFactory.h>
 #include <subsys/Shooter.h>
+#include <utils/LoopScheduler.h>
 #include <utils/Logger.h>
 
 // Third Party Includes
@@ -45,26 +57,145 @@
 using namespace frc;
 using namespace std;
 
-CyclePrimitives::CyclePrimitives() : m_primParams(), 
-									 m_currentPrimSlot(0), 
-								     m_currentPrim(nullptr), 
+CyclePrimitives::CyclePrimitives() : m_program(nullptr), 
+									 m_nextStep(0), 
+								     m_currentStep(nullptr), 
+									 m_runningPrims(0),
+									 m_holdChassis(false),
+									 m_timelineHandles(),
 									 m_primFactory(
 									 PrimitiveFactory::GetInstance()), 
 									 m_doNothing(nullptr), 
+									 m_doNothingParams(),
 									 m_autonSelector( new AutonSelector()) ,
 									 m_timer( make_unique<Timer>()),
 									 m_maxTime( 0.0 ),
-									 m_isDone( false )
+									 m_isDone( false ),
+									 m_planBuilder(),
+									 m_planBuilderFile(),
+									 m_plan(),
+									 m_planFile(),
+									 m_timeline(),
+									 m_mechanisms(string("AutonScheduler"), 1.0 / TimedRobot::kDefaultPeriod.value())
 {
+	// the lift isn't commanded by the primitives, so it only checks for a request at 10 Hz while it is off
+	// (except while shooting, when it has to feed as soon as the shooter is ready)
+	m_mechanisms.AddTask(string("left intake"), []() 
+	{ 
+		auto stateMgr = LeftIntakeStateMgr::GetInstance();
+		if (stateMgr != nullptr)
+		{
+			stateMgr->RunCurrentState();
+		}
+	}, 50.0);
+	m_mechanisms.AddTask(string("right intake"), []() 
+	{ 
+		auto stateMgr = RightIntakeStateMgr::GetInstance();
+		if (stateMgr != nullptr)
+		{
+			stateMgr->RunCurrentState();
+		}
+	}, 50.0);
+	m_mechanisms.AddTask(string("shooter"), []() 
+	{ 
+		auto stateMgr = ShooterStateMgr::GetInstance();
+		if (stateMgr != nullptr)
+		{
+			stateMgr->RunCurrentState();
+		}
+	}, 50.0);
+	m_mechanisms.AddTask(string("indexer"), []() 
+	{ 
+		auto stateMgr = IndexerStateMgr::GetInstance();
+		if (stateMgr != nullptr)
+		{
+			stateMgr->RunCurrentState();
+		}
+	}, 50.0);
+	m_mechanisms.AddTask(string("lift"), []() 
+	{ 
+		auto stateMgr = LiftStateMgr::GetInstance();
+		if (stateMgr != nullptr)
+		{
+			stateMgr->RunCurrentState();
+		}
+	}, 50.0, 10.0, []() 
+	{ 
+		auto stateMgr = LiftStateMgr::GetInstance();
+		auto shooterStateMgr = ShooterStateMgr::GetInstance();
+		return stateMgr == nullptr || 
+			   (stateMgr->GetCurrentState() == LiftStateMgr::LIFT_STATE::OFF && 
+			    (shooterStateMgr == nullptr || !shooterStateMgr->IsShooting()));
+	});
+	m_mechanisms.AddTask(string("telemetry"), [this]() { m_mechanisms.PublishStats(); }, 5.0);
+}
+
+void CyclePrimitives::UpdatePlan()
+{
+	// pick up a plan that finished building
+	if ( m_planBuilder.valid() && m_planBuilder.wait_for(chrono::seconds(0)) == future_status::ready )
+	{
+		m_program = nullptr;
+		m_plan = m_planBuilder.get();
+		m_planFile = m_planBuilderFile;
+		m_plan->Bind();
+		Logger::GetLogger()->ToNtTable(string("Auton Info"), string("Plan"), m_planFile);
+	}
+
+	// start building the plan for a new selection (one build at a time)
+	auto selected = m_autonSelector->GetSelectedAutoFile();
+	if ( !m_planBuilder.valid() && !selected.empty() && selected != m_planFile )
+	{
+		m_planBuilderFile = selected;
+		Logger::GetLogger()->ToNtTable(string("Auton Info"), string("Plan"), string("building ") + selected);
+		m_planBuilder = async( launch::async, [selected]() 
+		{
+			auto program = PrimitiveParser::ParseXML( selected );
+			for ( auto& param : *program )
+			{
+				if ( !param.GetPathName().empty() )
+				{
+					TrajectoryCache::GetInstance()->Load( param.GetPathName() );
+				}
+			}
+			return program;
+		});
+	}
 }
 
 void CyclePrimitives::Init()
 {
-	m_currentPrimSlot = 0; //Reset current prim
-	m_primParams.clear();
+	Init( m_autonSelector->GetSelectedAutoFile() );
+}
 
-	m_primParams = PrimitiveParser::ParseXML( m_autonSelector->GetSelectedAutoFile() );
-	if (!m_primParams.empty())
+void CyclePrimitives::Init
+(
+	const string&	selected
+)
+{
+	m_nextStep = 0; //Reset current prim
+	m_currentStep = nullptr;
+	m_runningPrims = 0;
+	m_isDone = false;
+	m_timeline.Clear();
+	m_mechanisms.Reset();
+
+	// use the plan built while disabled; if it is still building for this auton wait for it, 
+	// otherwise (e.g. the selection changed right before enabling) parse the auton now.  The
+	// plan is kept, so re-running the same auton reuses it.
+	if ( m_planBuilder.valid() )
+	{
+		m_plan = m_planBuilder.get();
+		m_planFile = m_planBuilderFile;
+	}
+	if ( m_plan.get() == nullptr || selected != m_planFile )
+	{
+		m_plan = PrimitiveParser::ParseXML( selected );
+		m_planFile = selected;
+	}
+	m_plan->Bind();
+	m_program = m_plan.get();
+	if (!m_program->Empty())
 	{
 		GetNextPrim();
 	}
@@ -72,40 +203,37 @@ void CyclePrimitives::Init()
 
 void CyclePrimitives::Run()
 {
-	if (m_currentPrim != nullptr)
+	if (m_currentStep != nullptr)
 	{
-		m_currentPrim->Run();
-		
-		auto leftIntakeStateMgr = LeftIntakeStateMgr::GetInstance();
-		if (leftIntakeStateMgr != nullptr)
-		{
-			leftIntakeStateMgr->RunCurrentState();
-		}
-		auto rightIntakeStateMgr = RightIntakeStateMgr::GetInstance();
-		if (rightIntakeStateMgr != nullptr)
-		{
-			rightIntakeStateMgr->RunCurrentState();
-		}
+		auto loopStart = Timer::GetFPGATimestamp();
 
-		auto shooterStateMgr = ShooterStateMgr::GetInstance();
-		if (shooterStateMgr != nullptr)
+		// run the primitives in the step together
+		auto driving = false;
+		for (size_t inx=0; inx<m_currentStep->count; ++inx)
 		{
-			shooterStateMgr->RunCurrentState();
+			if ((m_runningPrims & (1U << inx)) != 0)
+			{
+				auto slot = m_currentStep->first + inx;
+				m_program->GetPrimitive(slot)->Run();
+				driving = driving || AutonProgram::DrivesChassis(m_program->GetParams(slot)->GetID());
+			}
 		}
-
-		auto indexerStateMgr = IndexerStateMgr::GetInstance();
-		if (indexerStateMgr != nullptr)
+		if (m_holdChassis && !driving)
 		{
-			indexerStateMgr->RunCurrentState();
+			auto chassis = ChassisFactory::GetChassisFactory()->GetIChassis();
+			if (chassis != nullptr)
+			{
+				chassis->Drive(ChassisSpeeds(), 
+							   IChassis::CHASSIS_DRIVE_MODE::ROBOT_ORIENTED, 
+							   IChassis::HEADING_OPTION::MAINTAIN);
+			}
 		}
+		
+		m_mechanisms.Run();
 
-		auto liftStateMgr = LiftStateMgr::GetInstance();
-		if (liftStateMgr != nullptr)
-		{
-			liftStateMgr->RunCurrentState();
-		}
+		m_timeline.RecordLoop((Timer::GetFPGATimestamp() - loopStart).value());
 
-		if (m_currentPrim->IsDone())
+		if (IsStepDone())
 		{
 			GetNextPrim();
 		}
@@ -113,8 +241,8 @@ void CyclePrimitives::Run()
 	else
 	{
 		m_isDone = true;
-		m_primParams.clear();	// clear the primitive params vector
-		m_currentPrimSlot = 0;  //Reset current prim slot
+		m_program = nullptr;
+		m_nextStep = 0;  //Reset current prim slot
 		RunDoNothing();
 	}
 }
@@ -124,30 +252,85 @@ bool CyclePrimitives::AtTarget() const
 	return m_isDone;
 }
 
-void CyclePrimitives::GetNextPrim()
+bool CyclePrimitives::IsStepDone()
 {
-	PrimitiveParams* currentPrimParam = (m_currentPrimSlot < (int) m_primParams.size()) ? m_primParams[m_currentPrimSlot] : nullptr;
-
-	m_currentPrim = (currentPrimParam != nullptr) ? m_primFactory->GetIPrimitive(currentPrimParam) : nullptr;
-	if (m_currentPrim != nullptr)
+	auto now = Timer::GetFPGATimestamp().value();
+	auto done = false;
+	for (size_t inx=0; inx<m_currentStep->count; ++inx)
 	{
-		m_currentPrim->Init(currentPrimParam);
-
-		auto leftIntakeStateMgr = LeftIntakeStateMgr::GetInstance();
-		if (leftIntakeStateMgr != nullptr)
+		auto bit = 1U << inx;
+		auto primitive = m_program->GetPrimitive(m_currentStep->first + inx);
+		if ((m_runningPrims & bit) != 0 && primitive->IsDone())
 		{
-			leftIntakeStateMgr->SetCurrentState(currentPrimParam->GetLeftIntakeState(), true);
+			m_runningPrims &= ~bit;
+			m_timeline.End(m_timelineHandles[inx], primitive->GetDoneReason(), now, GetChassisPose());
+
+			// a race ends with the first primitive to finish, a deadline with its first primitive
+			done = done || m_currentStep->type == AutonProgram::GROUP_TYPE::RACE ||
+				   (m_currentStep->type == AutonProgram::GROUP_TYPE::DEADLINE && inx == 0);
 		}
-		auto rightIntakeStateMgr = RightIntakeStateMgr::GetInstance();
-		if (rightIntakeStateMgr != nullptr)
+	}
+	done = done || m_runningPrims == 0;
+	if (done && m_runningPrims != 0)
+	{
+		m_runningPrims = 0;
+		m_timeline.EndAll("interrupted", now, GetChassisPose());
+	}
+	return done;
+}
+
+void CyclePrimitives::GetNextPrim()
+{
+	m_currentStep = (m_program != nullptr) ? m_program->GetStep(m_nextStep) : nullptr;
+	m_runningPrims = 0;
+	m_holdChassis = false;
+	if (m_currentStep != nullptr)
+	{
+		auto now = Timer::GetFPGATimestamp().value();
+		auto pose = GetChassisPose();
+		m_maxTime = 0.0;
+		for (size_t inx=0; inx<m_currentStep->count; ++inx)
 		{
-			rightIntakeStateMgr->SetCurrentState(currentPrimParam->GetRightIntakeState(), true);
+			auto slot = m_currentStep->first + inx;
+			auto currentPrimParam = m_program->GetParams(slot);
+			auto primitive = m_program->GetPrimitive(slot);
+			if (primitive == nullptr)
+			{
+				continue;
+			}
+			primitive->Init(currentPrimParam);
+
+			m_runningPrims |= 1U << inx;
+			m_holdChassis = m_holdChassis || m_currentStep->type != AutonProgram::GROUP_TYPE::SINGLE || 
+							currentPrimParam->GetID() == RUN_MECHANISMS;
+			m_maxTime = max(m_maxTime, static_cast<double>(currentPrimParam->GetTime()));
+			m_timelineHandles[inx] = m_timeline.Start(slot, 
+													  currentPrimParam->GetID(), 
+													  currentPrimParam->GetTime(), 
+													  now, 
+													  pose);
 		}
-		auto shooterStateMgr = ShooterStateMgr::GetInstance();
-		if (shooterStateMgr != nullptr)
+
+		// a primitive on its own sets every mechanism (the ones it doesn't give go to their defaults);  in a 
+		// group, one primitive's defaults would undo what another gives, so each mechanism takes the state a
+		// primitive gives, else the RUN_MECHANISMS default (the parser rejects a group that gives a mechanism 
+		// two states)
+		const PrimitiveParams* leftIntake = nullptr;
+		const PrimitiveParams* rightIntake = nullptr;
+		const PrimitiveParams* shooter = nullptr;
+		for (size_t inx=0; inx<m_currentStep->count; ++inx)
 		{
-			shooterStateMgr->SetCurrentState(currentPrimParam->GetShooterState(), true);
+			if ((m_runningPrims & (1U << inx)) == 0)
+			{
+				continue;
+			}
+			auto params = m_program->GetParams(m_currentStep->first + inx);
+			auto setsAll = m_currentStep->type == AutonProgram::GROUP_TYPE::SINGLE || params->GetID() == RUN_MECHANISMS;
+			leftIntake = params->HasLeftIntakeState() || (setsAll && leftIntake == nullptr) ? params : leftIntake;
+			rightIntake = params->HasRightIntakeState() || (setsAll && rightIntake == nullptr) ? params : rightIntake;
+			shooter = params->HasShooterState() || (setsAll && shooter == nullptr) ? params : shooter;
 		}
+		SetMechanismStates(leftIntake, rightIntake, shooter);
 
 		auto indexerStateMgr = IndexerStateMgr::GetInstance();
 		if (indexerStateMgr != nullptr)
@@ -161,13 +344,41 @@ void CyclePrimitives::GetNextPrim()
 			liftStateMgr->RunCurrentState();
 		}
 
-
-		m_maxTime = currentPrimParam->GetTime();
 		m_timer->Reset();
 		m_timer->Start();
+
+		// nothing to run (e.g. an unknown primitive) ends the auton
+		if (m_runningPrims == 0)
+		{
+			m_currentStep = nullptr;
+		}
 	}
 
-	m_currentPrimSlot++;
+	m_nextStep++;
+}
+
+void CyclePrimitives::SetMechanismStates
+(
+	const PrimitiveParams*	leftIntake,
+	const PrimitiveParams*	rightIntake,
+	const PrimitiveParams*	shooter
+)
+{
+	auto leftIntakeStateMgr = LeftIntakeStateMgr::GetInstance();
+	if (leftIntakeStateMgr != nullptr && leftIntake != nullptr)
+	{
+		leftIntakeStateMgr->SetCurrentState(leftIntake->GetLeftIntakeState(), true, StateTrace::TRIGGER::AUTON);
+	}
+	auto rightIntakeStateMgr = RightIntakeStateMgr::GetInstance();
+	if (rightIntakeStateMgr != nullptr && rightIntake != nullptr)
+	{
+		rightIntakeStateMgr->SetCurrentState(rightIntake->GetRightIntakeState(), true, StateTrace::TRIGGER::AUTON);
+	}
+	auto shooterStateMgr = ShooterStateMgr::GetInstance();
+	if (shooterStateMgr != nullptr && shooter != nullptr)
+	{
+		shooterStateMgr->SetCurrentState(shooter->GetShooterState(), true, StateTrace::TRIGGER::AUTON);
+	}
 }
 
 void CyclePrimitives::RunDoNothing()
@@ -176,7 +387,7 @@ void CyclePrimitives::RunDoNothing()
 	{	
 		auto time = DriverStation::GetMatchType() != DriverStation::MatchType::kNone ? 
 							 DriverStation::GetMatchTime() : 15.0;
-		auto params = new PrimitiveParams( DO_NOTHING,          // identifier
+		m_doNothingParams = make_unique<PrimitiveParams>( DO_NOTHING,          // identifier
 		                                   time,              	// time
 		                                   0.0,                 // distance
 		                                   0.0,                 // target x location
@@ -189,15 +400,23 @@ void CyclePrimitives::RunDoNothing()
 										  IntakeStateMgr::INTAKE_STATE::OFF,
 										  IntakeStateMgr::INTAKE_STATE::OFF,
 										  ShooterStateMgr::SHOOTER_STATE::PREPARE_TO_SHOOT );             
-		m_doNothing = m_primFactory->GetIPrimitive(params);
-		m_doNothing->Init(params);
+		m_doNothing = m_primFactory->GetIPrimitive(m_doNothingParams.get());
+		m_doNothing->Init(m_doNothingParams.get());
 	}
 	m_doNothing->Run();
 }
 
+void CyclePrimitives::DumpTimeline()
+{
+	if (m_timeline.IsRunning())
+	{
+		m_timeline.EndAll("auton ended", Timer::GetFPGATimestamp().value(), GetChassisPose());
+	}
+	m_timeline.Dump(m_plan.get());
+}
 
-
-
-
-
-
+Pose2d CyclePrimitives::GetChassisPose() const
+{
+	auto chassis = ChassisFactory::GetChassisFactory()->GetIChassis();
+	return chassis != nullptr ? chassis->GetPose() : Pose2d();
+}
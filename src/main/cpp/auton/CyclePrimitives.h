@@ -17,14 +17,23 @@
 #pragma once
 
 // C++ Includes
+#include <array>
+#include <cstdint>
+#include <future>
 #include <memory>
+#include <string>
 #include <vector>
 
 // FRC includes
 #include <frc/Timer.h>
+#include <frc/geometry/Pose2d.h>
 
 // Team 302 includes
+#include <auton/AutonProgram.h>
+#include <auton/AutonTimeline.h>
+#include <auton/PrimitiveParams.h>
 #include <states/IState.h>
+#include <utils/LoopScheduler.h>
 
 // Third Party Includes
 
@@ -47,23 +56,63 @@ class CyclePrimitives : public IState
 		virtual ~CyclePrimitives() = default;
 
 		void Init() override;
+
+		/// @brief  Start running an auton file instead of the one selected on the dashboard
+		/// @param [in] const std::string& autonFile - file in the deploy/auton directory (or an absolute path)
+		void Init
+		(
+			const std::string&	autonFile
+		);
+
 		void Run() override;
 	 	bool AtTarget() const override;
 
+		/// @brief  Slot of the primitive that is running (the first one, when a group is running)
+		/// @return int - slot in the auton (-1 when no primitive is running)
+		int GetCurrentPrimitiveSlot() const { return m_currentStep != nullptr ? static_cast<int>(m_currentStep->first) : -1; }
+
+		/// @brief  Call while disabled.  When the selected auton changes, its XML is parsed and the
+		///         trajectories it uses are loaded on a background thread, so Init can use the built
+		///         plan without any file I/O.
+		void UpdatePlan();
+
+		/// @brief  Write the timeline of the last auton to the log (call once the auton is over)
+		void DumpTimeline();
+
+		const AutonTimeline& GetTimeline() const { return m_timeline; }
 
 	protected:
 		void GetNextPrim();
+		bool IsStepDone();
+		virtual void SetMechanismStates
+		(
+			const PrimitiveParams*	leftIntake,		// nullptr leaves the mechanism as it is
+			const PrimitiveParams*	rightIntake,
+			const PrimitiveParams*	shooter
+		);
 		void RunDoNothing();
+		frc::Pose2d GetChassisPose() const;
 
 	private:
-		std::vector<PrimitiveParams*> 	m_primParams;
-		int 							m_currentPrimSlot;
-		IPrimitive*						m_currentPrim;
+		AutonProgram*					m_program;				// program being run (owned by m_plan)
+		size_t 							m_nextStep;				// step in m_program to run next
+		const AutonProgram::Step*		m_currentStep;			// step that is running (nullptr if none)
+		uint32_t						m_runningPrims;			// bit per primitive of m_currentStep that is running
+		bool							m_holdChassis;			// stop the chassis once the step's drive primitive is done
+		std::array<size_t, AutonProgram::MAX_GROUP_SIZE>	m_timelineHandles;
 		PrimitiveFactory* 				m_primFactory;
 		IPrimitive* 					m_doNothing;
+		std::unique_ptr<PrimitiveParams>	m_doNothingParams;
 		AutonSelector* 					m_autonSelector;
 		std::unique_ptr<frc::Timer>     m_timer;
 		double                          m_maxTime;
 		bool							m_isDone;
+
+		std::future<std::unique_ptr<AutonProgram>>	m_planBuilder;	// plan being built in the background
+		std::string						m_planBuilderFile;		// auton file m_planBuilder is building
+		std::unique_ptr<AutonProgram>	m_plan;					// built plan
+		std::string						m_planFile;				// auton file m_plan was built from
+		AutonTimeline					m_timeline;
+		LoopScheduler					m_mechanisms;
 };
 
@@ -0,0 +1,280 @@
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302 
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+// C++ Includes
+#include <algorithm>
+#include <cmath>
+#include <exception>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// FRC includes
+#include <frc/geometry/Translation2d.h>
+#include <units/length.h>
+#include <wpi/json.h>
+
+// Team 302 includes
+#include <auton/BinaryTrajectory.h>
+#include <auton/PathPlannerLoader.h>
+#include <utils/Logger.h>
+
+// Third Party Includes
+
+using namespace std;
+
+namespace
+{
+    constexpr double PI = 3.14159265358979323846;
+
+    /// @brief  Wrap an angle in radians to (-pi, pi]
+    double Wrap
+    (
+        double  angle
+    )
+    {
+        return atan2(sin(angle), cos(angle));
+    }
+
+    /// @brief  Point on a cubic Bezier curve
+    frc::Translation2d Bezier
+    (
+        const frc::Translation2d&   p0,
+        const frc::Translation2d&   p1,
+        const frc::Translation2d&   p2,
+        const frc::Translation2d&   p3,
+        double                      t
+    )
+    {
+        auto u = 1.0 - t;
+        return p0 * (u * u * u) + p1 * (3.0 * u * u * t) + p2 * (3.0 * u * t * t) + p3 * (t * t * t);
+    }
+
+    frc::Translation2d ReadPoint
+    (
+        const wpi::json&            node,
+        const frc::Translation2d&   defaultPoint
+    )
+    {
+        if ( node.is_null() )
+        {
+            return defaultPoint;
+        }
+        return frc::Translation2d(units::meter_t(node.at("x").get<double>()), units::meter_t(node.at("y").get<double>()));
+    }
+
+    struct PathPoint
+    {
+        double  x;
+        double  y;
+        double  holonomic;      // radians
+        double  limit;          // max velocity from the constraints
+        double  distance;       // from the previous point
+        double  heading;        // direction of travel (radians)
+        double  curvature;
+        double  velocity;
+    };
+}
+
+shared_ptr<const BinaryTrajectory> PathPlannerLoader::Load
+(
+    const string&       pathFile
+)
+{
+    ifstream file(pathFile);
+    if ( !file.good() )
+    {
+        Logger::GetLogger()->LogError(string("PathPlannerLoader::Load"), string("unable to open ") + pathFile);
+        return nullptr;
+    }
+    stringstream contents;
+    contents << file.rdbuf();
+
+    vector<Waypoint> waypoints;
+    auto maxVelocity = DEFAULT_MAX_VELOCITY;
+    auto maxAcceleration = DEFAULT_MAX_ACCELERATION;
+    try
+    {
+        auto json = wpi::json::parse(contents.str());
+        if ( json.find("maxVelocity") != json.end() && !json.at("maxVelocity").is_null() )
+        {
+            maxVelocity = json.at("maxVelocity").get<double>();
+        }
+        if ( json.find("maxAcceleration") != json.end() && !json.at("maxAcceleration").is_null() )
+        {
+            maxAcceleration = json.at("maxAcceleration").get<double>();
+        }
+
+        for ( auto& node : json.at("waypoints") )
+        {
+            Waypoint waypoint;
+            waypoint.anchor = ReadPoint(node.at("anchorPoint"), frc::Translation2d());
+            waypoint.prevControl = ReadPoint(node.at("prevControl"), waypoint.anchor);
+            waypoint.nextControl = ReadPoint(node.at("nextControl"), waypoint.anchor);
+            waypoint.holonomicAngle = node.find("holonomicAngle") != node.end() ? node.at("holonomicAngle").get<double>() : 0.0;
+            waypoint.isReversal = node.find("isReversal") != node.end() && node.at("isReversal").get<bool>();
+            waypoint.velOverride = ( node.find("velOverride") != node.end() && !node.at("velOverride").is_null() ) ? 
+                                            node.at("velOverride").get<double>() : 0.0;
+            waypoints.emplace_back(waypoint);
+        }
+    }
+    catch ( const exception& e )
+    {
+        Logger::GetLogger()->LogError(string("PathPlannerLoader::Load"), pathFile + string(": ") + e.what());
+        return nullptr;
+    }
+
+    auto states = Generate(waypoints, maxVelocity, maxAcceleration);
+    if ( states.empty() )
+    {
+        Logger::GetLogger()->LogError(string("PathPlannerLoader::Load"), pathFile + string(" needs at least two waypoints"));
+        return nullptr;
+    }
+    return BinaryTrajectory::FromStates(move(states), true);
+}
+
+vector<BinaryTrajectoryState> PathPlannerLoader::Generate
+(
+    const vector<Waypoint>&     waypoints,
+    double                      maxVelocity,
+    double                      maxAcceleration
+)
+{
+    vector<BinaryTrajectoryState> states;
+    if ( waypoints.size() < 2 || maxVelocity <= 0.0 || maxAcceleration <= 0.0 )
+    {
+        return states;
+    }
+    states.reserve((waypoints.size() - 1) * SAMPLES_PER_SEGMENT + 1);
+
+    auto startTime = 0.0;
+    auto reversed = false;
+    size_t first = 0;
+    vector<PathPoint> points;
+    points.reserve(states.capacity());
+    while ( first < waypoints.size() - 1 )
+    {
+        // the robot stops at a reversal, so each run between reversals is profiled on its own
+        auto last = first + 1;
+        while ( last < waypoints.size() - 1 && !waypoints[last].isReversal )
+        {
+            last++;
+        }
+
+        // sample the Bezier segments
+        points.clear();
+        for ( auto seg = first; seg < last; ++seg )
+        {
+            auto& start = waypoints[seg];
+            auto& end = waypoints[seg+1];
+            auto limit = start.velOverride > 0.0 ? min(maxVelocity, start.velOverride) : maxVelocity;
+            auto startAngle = start.holonomicAngle * PI / 180.0;
+            auto turn = Wrap(end.holonomicAngle * PI / 180.0 - startAngle);
+            for ( auto inx = (seg == first ? 0 : 1); inx <= SAMPLES_PER_SEGMENT; ++inx )
+            {
+                auto t = static_cast<double>(inx) / SAMPLES_PER_SEGMENT;
+                auto pos = Bezier(start.anchor, start.nextControl, end.prevControl, end.anchor, t);
+                PathPoint point{ pos.X().to<double>(), pos.Y().to<double>(), Wrap(startAngle + turn * t), limit, 0.0, 0.0, 0.0, 0.0 };
+                if ( !points.empty() )
+                {
+                    point.distance = hypot(point.x - points.back().x, point.y - points.back().y);
+                    if ( point.distance < 1.0e-9 )
+                    {
+                        continue;
+                    }
+                }
+                points.emplace_back(point);
+            }
+        }
+
+        auto count = points.size();
+        if ( count > 1 )
+        {
+            // heading, curvature and the curvature velocity limit
+            for ( size_t inx=0; inx<count; ++inx )
+            {
+                auto from = inx < count - 1 ? inx : inx - 1;
+                points[inx].heading = atan2(points[from+1].y - points[from].y, points[from+1].x - points[from].x);
+            }
+            for ( size_t inx=1; inx<count; ++inx )
+            {
+                points[inx].curvature = Wrap(points[inx].heading - points[inx-1].heading) / points[inx].distance;
+                auto k = abs(points[inx].curvature);
+                if ( k > 1.0e-6 )
+                {
+                    points[inx].limit = min(points[inx].limit, sqrt(maxAcceleration / k));
+                }
+            }
+            points[0].curvature = points[1].curvature;
+
+            // forward pass (accelerate from a stop) then backward pass (decelerate to a stop)
+            points[0].velocity = 0.0;
+            for ( size_t inx=1; inx<count; ++inx )
+            {
+                auto reachable = sqrt(points[inx-1].velocity * points[inx-1].velocity + 2.0 * maxAcceleration * points[inx].distance);
+                points[inx].velocity = min(points[inx].limit, reachable);
+            }
+            points[count-1].velocity = 0.0;
+            for ( auto inx=count-1; inx>0; --inx )
+            {
+                auto reachable = sqrt(points[inx].velocity * points[inx].velocity + 2.0 * maxAcceleration * points[inx].distance);
+                points[inx-1].velocity = min(points[inx-1].velocity, reachable);
+            }
+
+            // time parameterize
+            auto sign = reversed ? -1.0 : 1.0;
+            auto time = startTime;
+            for ( size_t inx=0; inx<count; ++inx )
+            {
+                if ( inx > 0 )
+                {
+                    auto sum = points[inx].velocity + points[inx-1].velocity;
+                    time += sum > 1.0e-9 ? 2.0 * points[inx].distance / sum : 0.0;
+                }
+
+                // acceleration over the interval that starts at this point
+                auto acceleration = 0.0;
+                if ( inx < count - 1 )
+                {
+                    auto sum = points[inx+1].velocity + points[inx].velocity;
+                    auto dt = sum > 1.0e-9 ? 2.0 * points[inx+1].distance / sum : 0.0;
+                    acceleration = dt > 0.0 ? (points[inx+1].velocity - points[inx].velocity) / dt : 0.0;
+                }
+
+                // the reversal point ends one run and starts the next; keep it once
+                if ( inx == 0 && !states.empty() )
+                {
+                    continue;
+                }
+                states.emplace_back(BinaryTrajectoryState{ time,
+                                                           sign * points[inx].velocity,
+                                                           sign * acceleration,
+                                                           points[inx].x,
+                                                           points[inx].y,
+                                                           Wrap(points[inx].heading + (reversed ? PI : 0.0)),
+                                                           points[inx].curvature,
+                                                           points[inx].holonomic });
+            }
+            startTime = time;
+        }
+
+        reversed = !reversed;
+        first = last;
+    }
+    return states;
+}
@@ -0,0 +1,85 @@
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302 
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+#pragma once
+
+// C++ Includes
+#include <memory>
+#include <string>
+#include <vector>
+
+// FRC includes
+#include <frc/geometry/Translation2d.h>
+
+// Team 302 includes
+#include <auton/BinaryTrajectory.h>
+
+// Third Party Includes
+
+
+/// @class PathPlannerLoader
+/// @brief Reads a PathPlanner .path file (deploy/pathplanner) and generates its time-parameterized
+///        states in the BinaryTrajectory format DrivePath follows, so the generatedJSON export isn't
+///        needed.  Each segment is a cubic Bezier between anchor points; the holonomic angles are
+///        interpolated along each segment, a waypoint's velOverride limits the segment that starts
+///        there, and the robot stops at reversal waypoints (velocity is negated after each one, as
+///        PathPlanner does).  Velocity is also limited by curvature and the acceleration limit.
+///
+///        Optional top level "maxVelocity" and "maxAcceleration" values override the defaults.
+///        Generation takes a few milliseconds, so paths are loaded through the TrajectoryCache while
+///        disabled, not in a primitive's Init.
+class PathPlannerLoader
+{
+    public:
+        /// @brief  One waypoint from the .path file
+        struct Waypoint
+        {
+            frc::Translation2d  anchor;
+            frc::Translation2d  prevControl;        // same as anchor when the file has null
+            frc::Translation2d  nextControl;        // same as anchor when the file has null
+            double              holonomicAngle;     // degrees
+            bool                isReversal;
+            double              velOverride;        // meters per second (0.0 or less if not set)
+        };
+
+        static constexpr double     DEFAULT_MAX_VELOCITY     = 4.0;      // meters per second
+        static constexpr double     DEFAULT_MAX_ACCELERATION = 2.5;      // meters per second squared
+
+        /// @brief  Load a path
+        /// @param [in] const std::string& pathFile - full path to the .path file
+        /// @return std::shared_ptr<const BinaryTrajectory> - holonomic trajectory (nullptr if it can't be read)
+        static std::shared_ptr<const BinaryTrajectory> Load
+        (
+            const std::string&      pathFile
+        );
+
+        /// @brief  Generate the states for a set of waypoints
+        /// @param [in] const std::vector<Waypoint>& waypoints - at least two waypoints
+        /// @param [in] double maxVelocity - meters per second
+        /// @param [in] double maxAcceleration - meters per second squared
+        /// @return std::vector<BinaryTrajectoryState> - states in time order (empty if there are fewer than two waypoints)
+        static std::vector<BinaryTrajectoryState> Generate
+        (
+            const std::vector<Waypoint>&    waypoints,
+            double                          maxVelocity,
+            double                          maxAcceleration
+        );
+
+    private:
+        PathPlannerLoader() = delete;
+        ~PathPlannerLoader() = delete;
+
+        static constexpr int    SAMPLES_PER_SEGMENT = 100;
+};
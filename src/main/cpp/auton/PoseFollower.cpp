@@ -0,0 +1,212 @@
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302 
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+// C++ Includes
+#include <cmath>
+#include <memory>
+#include <vector>
+
+// FRC includes
+#include <frc/controller/HolonomicDriveController.h>
+#include <frc/controller/PIDController.h>
+#include <frc/controller/ProfiledPIDController.h>
+#include <frc/geometry/Pose2d.h>
+#include <frc/geometry/Translation2d.h>
+#include <frc/kinematics/ChassisSpeeds.h>
+#include <units/angular_acceleration.h>
+#include <units/angular_velocity.h>
+#include <units/velocity.h>
+
+// Team 302 includes
+#include <auton/PoseFollower.h>
+#include <auton/PoseTrajectoryGenerator.h>
+#include <subsys/ChassisFactory.h>
+#include <subsys/interfaces/IChassis.h>
+
+// Third Party Includes
+
+using namespace std;
+using namespace frc;
+
+PoseFollower::PoseFollower() : m_chassis(ChassisFactory::GetChassisFactory()->GetIChassis()),
+                               m_controller(frc2::PIDController{1.5, 0, 0},
+                                            frc2::PIDController{1.5, 0, 0},
+                                            frc::ProfiledPIDController<units::radian>{1.0, 0, 0,
+                                                                                      frc::TrapezoidProfile<units::radian>::Constraints{units::radians_per_second_t(3.14), units::radians_per_second_squared_t(3.14)}}),
+                               m_sampler(),
+                               m_trajectory(),
+                               m_timer(),
+                               m_target(),
+                               m_lastPose(),
+                               m_lastTime(0),
+                               m_velocity(),
+                               m_ticket(0),
+                               m_active(false),
+                               m_regenerated(false),
+                               m_hasVelocity(false)
+{
+}
+
+void PoseFollower::Start
+(
+    const Pose2d&   target
+)
+{
+    m_target = target;
+    m_trajectory.reset();
+    m_sampler.SetTrajectory(m_trajectory);
+    m_active = m_chassis != nullptr;
+    m_regenerated = false;
+    m_hasVelocity = false;
+    m_velocity = ChassisSpeeds();
+    if ( m_active )
+    {
+        m_lastPose = m_chassis->GetPose();
+        m_lastTime = Timer::GetFPGATimestamp();
+        m_ticket = PoseTrajectoryGenerator::GetInstance()->Request(m_lastPose, target);
+    }
+}
+
+void PoseFollower::Stop()
+{
+    m_active = false;
+    m_trajectory.reset();
+    m_sampler.SetTrajectory(m_trajectory);
+    m_timer.Stop();
+}
+
+bool PoseFollower::Calculate
+(
+    ChassisSpeeds&  speeds
+)
+{
+    if ( !m_active )
+    {
+        return false;
+    }
+    UpdateVelocity();
+    if ( IsDone() )
+    {
+        return false;
+    }
+
+    // swap in the trajectory once the worker has published it
+    if ( m_trajectory.get() == nullptr )
+    {
+        auto generator = PoseTrajectoryGenerator::GetInstance();
+        if ( !generator->IsReady(m_ticket) || !m_hasVelocity )
+        {
+            return false;
+        }
+        auto trajectory = generator->GetTrajectory(m_ticket);
+        if ( trajectory.get() == nullptr )
+        {
+            return false;
+        }
+
+        // the trajectory was planned from the pose and velocity at request time; if the robot is moving
+        // differently now, plan once more from here (after that the controller absorbs the difference)
+        auto pose = m_chassis->GetPose();
+        auto& first = trajectory.get()->GetState(0);
+        auto vxError = m_velocity.vx.to<double>() - first.velocity * cos(first.rotation);
+        auto vyError = m_velocity.vy.to<double>() - first.velocity * sin(first.rotation);
+        if ( !m_regenerated && hypot(vxError, vyError) > VELOCITY_TOLERANCE )
+        {
+            m_regenerated = true;
+            m_ticket = generator->Request(pose, m_target, m_velocity);
+            return false;
+        }
+
+        m_trajectory = Reanchor(trajectory, pose.Translation());
+        m_sampler.SetTrajectory(m_trajectory);
+        m_controller.GetThetaController().Reset(m_chassis->GetPose().Rotation().Radians());
+        m_timer.Reset();
+        m_timer.Start();
+    }
+
+    auto desired = m_sampler.Sample(m_timer.Get());
+    speeds = m_controller.Calculate(m_chassis->GetPose(), desired, m_target.Rotation());
+    return true;
+}
+
+bool PoseFollower::IsDone() const
+{
+    if ( !m_active )
+    {
+        return false;
+    }
+
+    if ( m_trajectory.get() == nullptr )
+    {
+        // ready without a trajectory: already there or it couldn't be generated;  a request that a
+        // newer one replaced will never be ready, so give up on it too
+        auto generator = PoseTrajectoryGenerator::GetInstance();
+        if ( generator->IsReady(m_ticket) )
+        {
+            return generator->GetTrajectory(m_ticket).get() == nullptr;
+        }
+        return generator->IsReplaced(m_ticket);
+    }
+
+    auto elapsed = m_timer.Get();
+    if ( !m_sampler.IsFinished(elapsed) )
+    {
+        return false;
+    }
+    auto error = m_target.Translation().Distance(m_chassis->GetPose().Translation()).to<double>();
+    return error < POSITION_TOLERANCE || elapsed > m_trajectory.get()->TotalTime() + units::second_t(END_TIMEOUT);
+}
+
+void PoseFollower::UpdateVelocity()
+{
+    auto pose = m_chassis->GetPose();
+    auto now = Timer::GetFPGATimestamp();
+    auto dt = (now - m_lastTime).to<double>();
+    if ( dt < MIN_VELOCITY_DT )
+    {
+        // same loop as the last sample (e.g. Start); the odometry hasn't moved yet
+        return;
+    }
+    m_velocity.vx = units::meters_per_second_t( (pose.X() - m_lastPose.X()).to<double>() / dt );
+    m_velocity.vy = units::meters_per_second_t( (pose.Y() - m_lastPose.Y()).to<double>() / dt );
+    m_hasVelocity = true;
+    m_lastPose = pose;
+    m_lastTime = now;
+}
+
+shared_ptr<const BinaryTrajectory> PoseFollower::Reanchor
+(
+    const shared_ptr<const BinaryTrajectory>&   trajectory,
+    const Translation2d&                        start
+)
+{
+    auto& first = trajectory.get()->GetState(0);
+    auto dx = start.X().to<double>() - first.x;
+    auto dy = start.Y().to<double>() - first.y;
+    if ( hypot(dx, dy) < REANCHOR_TOLERANCE )
+    {
+        return trajectory;
+    }
+
+    vector<BinaryTrajectoryState> states( trajectory.get()->States(), trajectory.get()->States() + trajectory.get()->Size() );
+    auto total = trajectory.get()->TotalTime().to<double>();
+    for ( auto& state : states )
+    {
+        auto remaining = total > 0.0 ? 1.0 - state.time / total : 0.0;
+        state.x += dx * remaining;
+        state.y += dy * remaining;
+    }
+    return BinaryTrajectory::FromStates( move(states), trajectory.get()->IsHolonomic() );
+}
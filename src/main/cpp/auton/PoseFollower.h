@@ -0,0 +1,112 @@
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302 
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+#pragma once
+
+// C++ Includes
+#include <memory>
+
+// FRC includes
+#include <frc/Timer.h>
+#include <frc/controller/HolonomicDriveController.h>
+#include <frc/geometry/Pose2d.h>
+#include <frc/geometry/Translation2d.h>
+#include <frc/kinematics/ChassisSpeeds.h>
+#include <units/time.h>
+
+// Team 302 includes
+#include <auton/BinaryTrajectory.h>
+#include <auton/TrajectorySampler.h>
+
+// Third Party Includes
+
+class IChassis;
+
+/// @class PoseFollower
+/// @brief Drives from the current pose to a target pose.  Start requests a trajectory from the
+///        PoseTrajectoryGenerator; until it is ready Calculate returns false and the caller keeps
+///        doing what it was doing (hold, or the driver's input).  When it is ready it is checked
+///        against where the robot is now: if the robot's velocity doesn't match the trajectory's start
+///        it is regenerated once from the current pose and velocity, and it is re-anchored so it starts
+///        at the current pose.  It is then followed with a holonomic controller that turns the robot
+///        to the target heading.
+class PoseFollower
+{
+    public:
+        PoseFollower();
+        ~PoseFollower() = default;
+
+        /// @brief  Start driving to a pose (from the chassis' current pose)
+        /// @param [in] const frc::Pose2d& target - field pose to drive to
+        void Start
+        (
+            const frc::Pose2d&      target
+        );
+
+        /// @brief  Stop following
+        void Stop();
+
+        /// @brief  Calculate the chassis speeds for this loop
+        /// @param [out] frc::ChassisSpeeds& speeds - robot relative speeds (only set when following)
+        /// @return bool - true if speeds was set; false if not started, still waiting for the trajectory or done
+        bool Calculate
+        (
+            frc::ChassisSpeeds&     speeds
+        );
+
+        /// @brief  Has Start been called (and not Stop)
+        bool IsActive() const { return m_active; }
+
+        /// @brief  Is a trajectory being followed
+        bool IsFollowing() const { return m_trajectory.get() != nullptr; }
+
+        /// @brief  Is the robot at the target (or there was nothing to generate, generation failed or
+        ///         the request was replaced by a newer one)
+        bool IsDone() const;
+
+        const frc::Pose2d& GetTarget() const { return m_target; }
+
+    private:
+        /// @brief  Estimate the field relative velocity from the change in pose since the last call
+        void UpdateVelocity();
+
+        /// @brief  Shift a trajectory so it starts at a position; the shift fades out along the
+        ///         trajectory so it still ends at the target
+        static std::shared_ptr<const BinaryTrajectory> Reanchor
+        (
+            const std::shared_ptr<const BinaryTrajectory>&  trajectory,
+            const frc::Translation2d&                       start
+        );
+
+        static constexpr double     POSITION_TOLERANCE = 0.05;     // meters
+        static constexpr double     END_TIMEOUT        = 1.0;      // seconds after the trajectory ends
+        static constexpr double     REANCHOR_TOLERANCE = 0.01;     // meters; closer than this the trajectory is used as is
+        static constexpr double     VELOCITY_TOLERANCE = 0.25;     // meters per second
+        static constexpr double     MIN_VELOCITY_DT    = 0.01;     // seconds between pose samples for the velocity
+
+        IChassis*                                   m_chassis;
+        frc::HolonomicDriveController               m_controller;
+        TrajectorySampler                           m_sampler;
+        std::shared_ptr<const BinaryTrajectory>     m_trajectory;
+        frc::Timer                                  m_timer;
+        frc::Pose2d                                 m_target;
+        frc::Pose2d                                 m_lastPose;
+        units::second_t                             m_lastTime;
+        frc::ChassisSpeeds                          m_velocity;     // field relative
+        unsigned int                                m_ticket;
+        bool                                        m_active;
+        bool                                        m_regenerated;
+        bool                                        m_hasVelocity;
+};
@@ -0,0 +1,282 @@
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302 
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+// C++ Includes
+#include <atomic>
+#include <cmath>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// FRC includes
+#include <frc/geometry/Pose2d.h>
+#include <frc/geometry/Rotation2d.h>
+#include <frc/geometry/Translation2d.h>
+#include <frc/kinematics/ChassisSpeeds.h>
+#include <frc/trajectory/TrajectoryConfig.h>
+#include <frc/trajectory/TrajectoryGenerator.h>
+#include <units/acceleration.h>
+#include <units/math.h>
+#include <units/velocity.h>
+
+// Team 302 includes
+#include <auton/BinaryTrajectory.h>
+#include <auton/PoseTrajectoryGenerator.h>
+#include <subsys/ChassisFactory.h>
+#include <subsys/interfaces/IChassis.h>
+#include <utils/Logger.h>
+
+// Third Party Includes
+
+using namespace std;
+using namespace frc;
+
+PoseTrajectoryGenerator* PoseTrajectoryGenerator::m_instance = nullptr;
+
+namespace
+{
+    units::meters_per_second_t GetMaxSpeed
+    (
+        double  fraction
+    )
+    {
+        auto chassis = ChassisFactory::GetChassisFactory()->GetIChassis();
+        auto maxSpeed = chassis != nullptr ? chassis->GetMaxSpeed() : units::meters_per_second_t(3.0);
+        return maxSpeed * fraction;
+    }
+}
+
+PoseTrajectoryGenerator* PoseTrajectoryGenerator::GetInstance()
+{
+    if ( PoseTrajectoryGenerator::m_instance == nullptr )
+    {
+        PoseTrajectoryGenerator::m_instance = new PoseTrajectoryGenerator();
+    }
+    return PoseTrajectoryGenerator::m_instance;
+}
+
+PoseTrajectoryGenerator::PoseTrajectoryGenerator() : m_mutex(),
+                                                     m_wakeup(),
+                                                     m_hasRequest(false),
+                                                     m_stop(false),
+                                                     m_nextTicket(0),
+                                                     m_requestTicket(0),
+                                                     m_start(),
+                                                     m_end(),
+                                                     m_velocity(),
+                                                     m_cache(),
+                                                     m_result(),
+                                                     m_config(GetMaxSpeed(SPEED_FRACTION), units::meters_per_second_squared_t(MAX_ACCEL)),
+                                                     m_worker()
+{
+    m_worker = thread( &PoseTrajectoryGenerator::Run, this );
+}
+
+PoseTrajectoryGenerator::~PoseTrajectoryGenerator()
+{
+    {
+        lock_guard<mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_wakeup.notify_one();
+    if ( m_worker.joinable() )
+    {
+        m_worker.join();
+    }
+}
+
+unsigned int PoseTrajectoryGenerator::Request
+(
+    const Pose2d&           start,
+    const Pose2d&           end,
+    const ChassisSpeeds&    velocity
+)
+{
+    unsigned int ticket = 0;
+    auto needed = false;
+    {
+        lock_guard<mutex> lock(m_mutex);
+        ticket = ++m_nextTicket;
+
+        // cached trajectories start at rest, so they only fit a robot that is stopped
+        auto itr = IsStopped(velocity) ? m_cache.find( GetKey(start, end) ) : m_cache.end();
+        if ( itr != m_cache.end() )
+        {
+            m_hasRequest = false;
+            Publish( ticket, itr->second );
+        }
+        else if ( end.Translation().Distance(start.Translation()).to<double>() < MIN_DISTANCE )
+        {
+            m_hasRequest = false;
+            Publish( ticket, nullptr );
+        }
+        else
+        {
+            m_start = start;
+            m_end = end;
+            m_velocity = velocity;
+            m_requestTicket = ticket;
+            m_hasRequest = true;
+            needed = true;
+        }
+    }
+
+    if ( needed )
+    {
+        m_wakeup.notify_one();
+    }
+    return ticket;
+}
+
+bool PoseTrajectoryGenerator::IsReady
+(
+    unsigned int    ticket
+) const
+{
+    auto result = atomic_load( &m_result );
+    return result.get() != nullptr && result.get()->ticket == ticket;
+}
+
+bool PoseTrajectoryGenerator::IsReplaced
+(
+    unsigned int    ticket
+) const
+{
+    lock_guard<mutex> lock(m_mutex);
+    return ticket < m_nextTicket && !IsReady(ticket);
+}
+
+shared_ptr<const BinaryTrajectory> PoseTrajectoryGenerator::GetTrajectory
+(
+    unsigned int    ticket
+) const
+{
+    auto result = atomic_load( &m_result );
+    return ( result.get() != nullptr && result.get()->ticket == ticket ) ? result.get()->trajectory : nullptr;
+}
+
+void PoseTrajectoryGenerator::Run()
+{
+    while ( true )
+    {
+        unsigned int ticket = 0;
+        Pose2d start;
+        Pose2d end;
+        ChassisSpeeds velocity;
+        {
+            unique_lock<mutex> lock(m_mutex);
+            m_wakeup.wait( lock, [this] { return m_hasRequest || m_stop; } );
+            if ( m_stop )
+            {
+                return;
+            }
+            ticket = m_requestTicket;
+            start = m_start;
+            end = m_end;
+            velocity = m_velocity;
+            m_hasRequest = false;
+        }
+
+        // generate without holding the lock, so the robot loop can keep making requests
+        auto trajectory = Generate( start, end, velocity );
+
+        lock_guard<mutex> lock(m_mutex);
+        if ( trajectory.get() != nullptr && IsStopped(velocity) )
+        {
+            if ( m_cache.size() >= MAX_CACHED )
+            {
+                m_cache.clear();
+            }
+            m_cache[GetKey(start, end)] = trajectory;
+        }
+        Publish( ticket, trajectory );
+    }
+}
+
+void PoseTrajectoryGenerator::Publish
+(
+    unsigned int                        ticket,
+    shared_ptr<const BinaryTrajectory>  trajectory
+)
+{
+    // called with m_mutex held; don't let a slow, older request replace a newer result
+    auto current = atomic_load( &m_result );
+    if ( current.get() == nullptr || current.get()->ticket < ticket )
+    {
+        auto result = make_shared<const Result>( Result{ ticket, trajectory } );
+        atomic_store( &m_result, result );
+    }
+}
+
+shared_ptr<const BinaryTrajectory> PoseTrajectoryGenerator::Generate
+(
+    const Pose2d&           start,
+    const Pose2d&           end,
+    const ChassisSpeeds&    velocity
+) const
+{
+    // the waypoint headings are the direction of travel; the robot heading is handled by the follower.
+    // When the robot is already moving the path leaves in the direction it is moving at its current speed.
+    auto travel = end.Translation() - start.Translation();
+    Rotation2d direction( travel.X().to<double>(), travel.Y().to<double>() );
+    auto startDirection = direction;
+
+    TrajectoryConfig config( m_config.MaxVelocity(), m_config.MaxAcceleration() );
+    if ( !IsStopped(velocity) )
+    {
+        startDirection = Rotation2d( velocity.vx.to<double>(), velocity.vy.to<double>() );
+        config.SetStartVelocity( units::math::min(units::math::hypot(velocity.vx, velocity.vy), m_config.MaxVelocity()) );
+    }
+
+    try
+    {
+        auto trajectory = TrajectoryGenerator::GenerateTrajectory( Pose2d(start.Translation(), startDirection),
+                                                                   vector<Translation2d>(),
+                                                                   Pose2d(end.Translation(), direction),
+                                                                   config );
+        if ( !trajectory.States().empty() )
+        {
+            return BinaryTrajectory::FromTrajectory( trajectory );
+        }
+    }
+    catch ( const exception& e )
+    {
+        Logger::GetLogger()->LogError( string("PoseTrajectoryGenerator::Generate"), string(e.what()) );
+    }
+    return nullptr;
+}
+
+bool PoseTrajectoryGenerator::IsStopped
+(
+    const ChassisSpeeds&    velocity
+)
+{
+    return units::math::hypot(velocity.vx, velocity.vy).to<double>() < STOPPED_SPEED;
+}
+
+PoseTrajectoryGenerator::CacheKey PoseTrajectoryGenerator::GetKey
+(
+    const Pose2d&   start,
+    const Pose2d&   end
+)
+{
+    return CacheKey{ static_cast<int>( lround(start.X().to<double>() / POSITION_BUCKET) ),
+                     static_cast<int>( lround(start.Y().to<double>() / POSITION_BUCKET) ),
+                     static_cast<int>( lround(end.X().to<double>() / POSITION_BUCKET) ),
+                     static_cast<int>( lround(end.Y().to<double>() / POSITION_BUCKET) ) };
+}
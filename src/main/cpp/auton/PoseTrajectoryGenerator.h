@@ -0,0 +1,144 @@
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302 
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+#pragma once
+
+// C++ Includes
+#include <array>
+#include <condition_variable>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+// FRC includes
+#include <frc/geometry/Pose2d.h>
+#include <frc/kinematics/ChassisSpeeds.h>
+#include <frc/trajectory/TrajectoryConfig.h>
+
+// Team 302 includes
+#include <auton/BinaryTrajectory.h>
+
+// Third Party Includes
+
+
+/// @class PoseTrajectoryGenerator
+/// @brief Generates trajectories from one pose to another with the WPILib TrajectoryGenerator on a
+///        worker thread, so generation never runs in the 20 ms loop.  A request returns a ticket
+///        right away; the result is published with one atomic swap and the caller polls for it with
+///        the ticket.  Results for moves that start at rest are cached by start/end buckets, so
+///        repeating a move from about the same spot (e.g. driving to the shooting spot) is immediate;
+///        a cached trajectory may start up to half a bucket from the robot, so the follower re-anchors
+///        it.  A move that starts while driving is generated from that velocity and isn't cached.
+class PoseTrajectoryGenerator
+{
+    public:
+        /// @brief  Find or create the singleton (this starts the worker thread)
+        /// @return PoseTrajectoryGenerator* - the generator
+        static PoseTrajectoryGenerator* GetInstance();
+
+        /// @brief  Request a trajectory; a request that hasn't started generating yet is replaced
+        /// @param [in] const frc::Pose2d& start - current pose
+        /// @param [in] const frc::Pose2d& end - target pose
+        /// @param [in] const frc::ChassisSpeeds& velocity - current field relative velocity (omega is ignored)
+        /// @return unsigned int - ticket for IsReady, IsReplaced and GetTrajectory
+        unsigned int Request
+        (
+            const frc::Pose2d&          start,
+            const frc::Pose2d&          end,
+            const frc::ChassisSpeeds&   velocity = frc::ChassisSpeeds()
+        );
+
+        /// @brief  Has the trajectory for a ticket been generated
+        bool IsReady
+        (
+            unsigned int            ticket
+        ) const;
+
+        /// @brief  Has a newer request replaced a ticket before its trajectory was published (it will
+        ///         never become ready)
+        bool IsReplaced
+        (
+            unsigned int            ticket
+        ) const;
+
+        /// @brief  Trajectory for a ticket
+        /// @return std::shared_ptr<const BinaryTrajectory> - nullptr while it is being generated, if it
+        ///                                                   was replaced by a newer request, if the poses
+        ///                                                   are already within tolerance or if generation failed
+        std::shared_ptr<const BinaryTrajectory> GetTrajectory
+        (
+            unsigned int            ticket
+        ) const;
+
+    private:
+        PoseTrajectoryGenerator();
+        ~PoseTrajectoryGenerator();
+
+        /// @brief  x and y buckets for the start and end poses (the waypoint headings are the direction
+        ///         of travel, so the pose rotations don't change the trajectory)
+        typedef std::array<int, 4>  CacheKey;
+
+        struct Result
+        {
+            unsigned int                                ticket;
+            std::shared_ptr<const BinaryTrajectory>     trajectory;
+        };
+
+        void Run();
+        void Publish
+        (
+            unsigned int                                ticket,
+            std::shared_ptr<const BinaryTrajectory>     trajectory
+        );
+        std::shared_ptr<const BinaryTrajectory> Generate
+        (
+            const frc::Pose2d&          start,
+            const frc::Pose2d&          end,
+            const frc::ChassisSpeeds&   velocity
+        ) const;
+        static bool IsStopped
+        (
+            const frc::ChassisSpeeds&   velocity
+        );
+        static CacheKey GetKey
+        (
+            const frc::Pose2d&      start,
+            const frc::Pose2d&      end
+        );
+
+        static PoseTrajectoryGenerator*     m_instance;
+
+        static constexpr double     POSITION_BUCKET = 0.25;     // meters
+        static constexpr double     MIN_DISTANCE    = 0.05;     // meters; closer than this there is nothing to generate
+        static constexpr double     MAX_ACCEL       = 2.0;      // meters per second squared
+        static constexpr double     SPEED_FRACTION  = 0.75;     // fraction of the chassis max speed
+        static constexpr double     STOPPED_SPEED   = 0.1;      // meters per second; slower than this starts from rest
+        static constexpr size_t     MAX_CACHED      = 64;
+
+        mutable std::mutex                                          m_mutex;
+        std::condition_variable                                     m_wakeup;
+        bool                                                        m_hasRequest;
+        bool                                                        m_stop;
+        unsigned int                                                m_nextTicket;
+        unsigned int                                                m_requestTicket;
+        frc::Pose2d                                                 m_start;
+        frc::Pose2d                                                 m_end;
+        frc::ChassisSpeeds                                          m_velocity;
+        std::map<CacheKey, std::shared_ptr<const BinaryTrajectory>> m_cache;
+        std::shared_ptr<const Result>                               m_result;       // only accessed with std::atomic_load/atomic_store
+        frc::TrajectoryConfig                                       m_config;
+        std::thread                                                 m_worker;
+};
@@ -38,6 +38,8 @@
              TURN_ANGLE_REL,
              DRIVE_PATH,
              RESET_POSITION,
+             DRIVE_TO_POSE,
+             RUN_MECHANISMS,
              MAX_AUTON_PRIMITIVES
          };
 
@@ -23,11 +23,13 @@
 #include <auton/primitives/DriveDistance.h>
 #include <auton/primitives/DrivePath.h>
 #include <auton/primitives/DriveTime.h>
+#include <auton/primitives/DriveToPose.h>
 #include <auton/primitives/DriveToTarget.h>
 #include <auton/primitives/DriveToWall.h>
 #include <auton/primitives/HoldPosition.h>
 #include <auton/primitives/IPrimitive.h>
 #include <auton/primitives/ResetPosition.h>
+#include <auton/primitives/RunMechanisms.h>
 #include <auton/primitives/TurnAngle.h>
 
 PrimitiveFactory* PrimitiveFactory::m_instance = nullptr;
@@ -50,7 +52,9 @@ PrimitiveFactory::PrimitiveFactory() :
 				m_driveToWall(nullptr),
 				m_driveLidarDistance( nullptr ),
 				m_resetPosition( nullptr ),
-				m_drivePath(nullptr)
+				m_drivePath(nullptr),
+				m_driveToPose(nullptr),
+				m_runMechanisms(nullptr)
 {
 }
 
@@ -135,6 +139,22 @@ IPrimitive* PrimitiveFactory::GetIPrimitive(PrimitiveParams* primitivePasser)
 			}
 			primitive = m_drivePath;
 			break;
+
+		case DRIVE_TO_POSE :
+			if (m_driveToPose == nullptr)
+			{
+				m_driveToPose = new DriveToPose();
+			}
+			primitive = m_driveToPose;
+			break;
+
+		case RUN_MECHANISMS :
+			if (m_runMechanisms == nullptr)
+			{
+				m_runMechanisms = new RunMechanisms();
+			}
+			primitive = m_runMechanisms;
+			break;
 			
 		default:
 			break;	
@@ -53,5 +53,7 @@ private:
     IPrimitive* m_autoShoot;
     IPrimitive* m_resetPosition;
     IPrimitive* m_drivePath;
+    IPrimitive* m_driveToPose;
+    IPrimitive* m_runMechanisms;
 };
 
@@ -48,7 +48,10 @@ PrimitiveParams::PrimitiveParams
 		m_pathName (pathName),
 		m_leftIntakeState(leftIntakeState),
 		m_rightIntakeState(rightIntakeState),
-		m_shooterState(shooterState)
+		m_shooterState(shooterState),
+		m_hasLeftIntakeState(true),
+		m_hasRightIntakeState(true),
+		m_hasShooterState(true)
 {
 }
 
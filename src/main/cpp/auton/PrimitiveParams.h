@@ -66,14 +66,25 @@ class PrimitiveParams
         float GetHeading() const {return m_heading;};
         float GetDriveSpeed() const {return m_startDriveSpeed;};
         float GetEndDriveSpeed() const {return m_endDriveSpeed;};
-        std::string GetPathName() const {return m_pathName;};
+        const std::string& GetPathName() const {return m_pathName;};
         IntakeStateMgr::INTAKE_STATE GetLeftIntakeState() const {return m_leftIntakeState;};
         IntakeStateMgr::INTAKE_STATE GetRightIntakeState() const {return m_rightIntakeState;};
         ShooterStateMgr::SHOOTER_STATE GetShooterState() const {return m_shooterState;};
 
+        // whether the mechanism state was given (false means it is the default)
+        bool HasLeftIntakeState() const {return m_hasLeftIntakeState;};
+        bool HasRightIntakeState() const {return m_hasRightIntakeState;};
+        bool HasShooterState() const {return m_hasShooterState;};
+
 
         //Setters
         void SetDistance(float distance) {m_distance = distance;};
+        void SetGivenMechanismStates(bool leftIntake, bool rightIntake, bool shooter) 
+        {
+            m_hasLeftIntakeState = leftIntake;
+            m_hasRightIntakeState = rightIntake;
+            m_hasShooterState = shooter;
+        };
 
     private:
         //Primitive Parameters
@@ -90,10 +101,12 @@ class PrimitiveParams
         IntakeStateMgr::INTAKE_STATE                        m_leftIntakeState;
         IntakeStateMgr::INTAKE_STATE                        m_rightIntakeState;
         ShooterStateMgr::SHOOTER_STATE                      m_shooterState;
+        bool                                                m_hasLeftIntakeState;
+        bool                                                m_hasRightIntakeState;
+        bool                                                m_hasShooterState;
 
 };
 
-typedef std::vector<PrimitiveParams*> PrimitiveParamsVector;
 
 
 
@@ -14,10 +14,12 @@
 //====================================================================================================================================================
 
 #include <map>
+#include <memory>
 #include <string>
 
 #include <frc/Filesystem.h>
 
+#include <auton/AutonProgram.h>
 #include <auton/AutonSelector.h>
 #include <auton/PrimitiveEnums.h>
 #include <auton/PrimitiveParams.h>
@@ -34,19 +36,22 @@
 using namespace std;
 using namespace pugi;
 
-PrimitiveParamsVector PrimitiveParser::ParseXML
+unique_ptr<AutonProgram> PrimitiveParser::ParseXML
 (
-    string     fileName
+    string                  fileName,
+    vector<string>*         errors,
+    bool                    publish
 )
 {
 
-    PrimitiveParamsVector paramVector;
+    unique_ptr<AutonProgram> program;
     auto hasError = false;
 
 	auto deployDir = frc::filesystem::GetDeployDirectory();
 	auto autonDir = deployDir + "/auton/";
 
-    string fulldirfile = autonDir;
+    // an absolute path (e.g. a test auton) is used as is
+    string fulldirfile = fileName.rfind("/", 0) == 0 ? string() : autonDir;
     fulldirfile += fileName;
     // initialize the xml string to enum maps
     map<string, PRIMITIVE_IDENTIFIER> primStringToEnumMap;
@@ -59,6 +64,8 @@ PrimitiveParamsVector PrimitiveParser::ParseXML
     primStringToEnumMap["TURN_ANGLE_REL"] = TURN_ANGLE_REL;
     primStringToEnumMap["DRIVE_PATH"] = DRIVE_PATH;
     primStringToEnumMap["RESET_POSITION"] = RESET_POSITION;
+    primStringToEnumMap["DRIVE_TO_POSE"] = DRIVE_TO_POSE;
+    primStringToEnumMap["RUN_MECHANISMS"] = RUN_MECHANISMS;
 
     map<string, IChassis::HEADING_OPTION> headingOptionMap;
     headingOptionMap["MAINTAIN"] = IChassis::HEADING_OPTION::MAINTAIN;
@@ -74,177 +81,351 @@ PrimitiveParamsVector PrimitiveParser::ParseXML
    
     if ( result )
     {
-        xml_node auton = doc.root();
-        for (xml_node node = auton.first_child(); node; node = node.next_sibling())
+        // size the program once so its primitives are stored contiguously
+        size_t count = 0;
+        for (xml_node node = doc.root().first_child(); node; node = node.next_sibling())
         {
             for (xml_node primitiveNode = node.first_child(); primitiveNode; primitiveNode = primitiveNode.next_sibling())
             {
                 if ( strcmp( primitiveNode.name(), "primitive") == 0 )
                 {
-                    auto primitiveType = UNKNOWN_PRIMITIVE;
-                    auto time = 15.0;
-                    auto distance = 0.0;
-                    auto headingOption = IChassis::HEADING_OPTION::MAINTAIN;
-                    auto heading = 0.0;
-                    auto startDriveSpeed = 0.0;
-                    auto endDriveSpeed = 0.0;
-                    auto xloc = 0.0;
-                    auto yloc = 0.0;
-                    std::string pathName;
-                    auto leftIntakeState = IntakeStateMgr::INTAKE_STATE::OFF;
-                    auto rightIntakeState = IntakeStateMgr::INTAKE_STATE::OFF;
-                    auto shooterState = ShooterStateMgr::SHOOTER_STATE::PREPARE_TO_SHOOT;                    
-                    
-                    for (xml_attribute attr = primitiveNode.first_attribute(); attr; attr = attr.next_attribute())
-                    {
-                        if ( strcmp( attr.name(), "id" ) == 0 )
-                        {
-                            auto paramStringToEnumItr = primStringToEnumMap.find( attr.value() );
-                            if ( paramStringToEnumItr != primStringToEnumMap.end() )
-                            {
-                                primitiveType = paramStringToEnumItr->second;
-                            }
-                            else
-                            {
-                                Logger::GetLogger()->LogError( string("PrimitiveParser::ParseXML invalid id"), attr.value());
-                                hasError = true;
-                            }
-                        }
-                        else if ( strcmp( attr.name(), "time" ) == 0 )
-                        {
-                            time = attr.as_float();
-                        }
-                        else if ( strcmp( attr.name(), "distance" ) == 0 )
-                        {
-                            distance = attr.as_float();
-                        }
-                        else if ( strcmp( attr.name(), "headingOption" ) == 0 )
+                    count++;
+                }
+                for (xml_node groupNode = primitiveNode.child("primitive"); groupNode; groupNode = groupNode.next_sibling("primitive"))
+                {
+                    count++;
+                }
+            }
+        }
+        program = make_unique<AutonProgram>( count );
+
+        // parse a <primitive> into the program
+        auto parsePrimitive = [&]( xml_node primitiveNode )
+        {
+            auto primitiveType = UNKNOWN_PRIMITIVE;
+            auto time = 15.0;
+            auto distance = 0.0;
+            auto headingOption = IChassis::HEADING_OPTION::MAINTAIN;
+            auto heading = 0.0;
+            auto startDriveSpeed = 0.0;
+            auto endDriveSpeed = 0.0;
+            auto xloc = 0.0;
+            auto yloc = 0.0;
+            std::string pathName;
+            auto leftIntakeState = IntakeStateMgr::INTAKE_STATE::OFF;
+            auto rightIntakeState = IntakeStateMgr::INTAKE_STATE::OFF;
+            auto shooterState = ShooterStateMgr::SHOOTER_STATE::PREPARE_TO_SHOOT;                    
+            auto hasLeftIntakeState = false;
+            auto hasRightIntakeState = false;
+            auto hasShooterState = false;
+            
+            for (xml_attribute attr = primitiveNode.first_attribute(); attr; attr = attr.next_attribute())
+            {
+                if ( strcmp( attr.name(), "id" ) == 0 )
+                {
+                    auto paramStringToEnumItr = primStringToEnumMap.find( attr.value() );
+                    if ( paramStringToEnumItr != primStringToEnumMap.end() )
+                    {
+                        primitiveType = paramStringToEnumItr->second;
+                    }
+                    else
+                    {
+                        Logger::GetLogger()->LogError( string("PrimitiveParser::ParseXML invalid id"), attr.value());
+                        if ( errors != nullptr )
                         {
-                            auto headingItr = headingOptionMap.find( attr.value() );
-                            if ( headingItr != headingOptionMap.end() )
-                            {
-                                headingOption = headingItr->second;
-                            }
-                            else
-                            {
-                                Logger::GetLogger()->LogError( string("PrimitiveParser::ParseXML invalid heading option"), attr.value());
-                                hasError = true;
-                            }
+                            errors->emplace_back( string("invalid id ") + attr.value() );
                         }
-                        else if ( strcmp( attr.name(), "heading" ) == 0 )
+                        hasError = true;
+                    }
+                }
+                else if ( strcmp( attr.name(), "time" ) == 0 )
+                {
+                    time = attr.as_float();
+                }
+                else if ( strcmp( attr.name(), "distance" ) == 0 )
+                {
+                    distance = attr.as_float();
+                }
+                else if ( strcmp( attr.name(), "headingOption" ) == 0 )
+                {
+                    auto headingItr = headingOptionMap.find( attr.value() );
+                    if ( headingItr != headingOptionMap.end() )
+                    {
+                        headingOption = headingItr->second;
+                    }
+                    else
+                    {
+                        Logger::GetLogger()->LogError( string("PrimitiveParser::ParseXML invalid heading option"), attr.value());
+                        if ( errors != nullptr )
                         {
-                            heading = attr.as_float();
+                            errors->emplace_back( string("invalid heading option ") + attr.value() );
                         }
-                        else if ( strcmp( attr.name(), "drivespeed" ) == 0 )
+                        hasError = true;
+                    }
+                }
+                else if ( strcmp( attr.name(), "heading" ) == 0 )
+                {
+                    heading = attr.as_float();
+                }
+                else if ( strcmp( attr.name(), "drivespeed" ) == 0 )
+                {
+                    startDriveSpeed = attr.as_float();
+                }
+                else if ( strcmp( attr.name(), "enddrivespeed" ) == 0 )
+                {
+                    endDriveSpeed = attr.as_float();
+                }
+                else if ( strcmp( attr.name(), "xloc" ) == 0 )
+                {
+                    xloc = attr.as_float();
+                }
+                else if ( strcmp( attr.name(), "yloc" ) == 0 )
+                {
+                    yloc = attr.as_float();
+                }
+                else if ( strcmp( attr.name(), "pathname") == 0)
+                {
+                    pathName = attr.value();
+                }                
+                else if ( strcmp( attr.name(), "leftIntake" ) == 0 )
+                {
+                    auto leftItr = IntakeStateMgr::m_intakeXmlStringToStateEnumMap.find( attr.value() );
+                    if ( leftItr != IntakeStateMgr::m_intakeXmlStringToStateEnumMap.end() )
+                    {
+                        leftIntakeState = leftItr->second;
+                        hasLeftIntakeState = true;
+                    }
+                    else
+                    {
+                        Logger::GetLogger()->LogError( string("PrimitiveParser::ParseXML invalid left intake state"), attr.value());
+                        if ( errors != nullptr )
                         {
-                            startDriveSpeed = attr.as_float();
+                            errors->emplace_back( string("invalid left intake state ") + attr.value() );
                         }
-                        else if ( strcmp( attr.name(), "enddrivespeed" ) == 0 )
+                        hasError = true;
+                    }
+                }
+                else if ( strcmp( attr.name(), "rightIntake" ) == 0 )
+                {
+                    auto rightItr = IntakeStateMgr::m_intakeXmlStringToStateEnumMap.find( attr.value() );
+                    if ( rightItr != IntakeStateMgr::m_intakeXmlStringToStateEnumMap.end() )
+                    {
+                        rightIntakeState = rightItr->second;
+                        hasRightIntakeState = true;
+                    }
+                    else
+                    {
+                        Logger::GetLogger()->LogError( string("PrimitiveParser::ParseXML invalid right intake state"), attr.value());
+                        if ( errors != nullptr )
                         {
-                            endDriveSpeed = attr.as_float();
+                            errors->emplace_back( string("invalid right intake state ") + attr.value() );
                         }
-                        else if ( strcmp( attr.name(), "xloc" ) == 0 )
+                        hasError = true;
+                    }
+                }
+                else if ( strcmp( attr.name(), "shooter" ) == 0 )
+                {
+                    auto shootItr = ShooterStateMgr::m_shooterXmlStringToStateEnumMap.find( attr.value() );
+                    if ( shootItr != ShooterStateMgr::m_shooterXmlStringToStateEnumMap.end() )
+                    {
+                        shooterState = shootItr->second;
+                        hasShooterState = true;
+                    }
+                    else
+                    {
+                        Logger::GetLogger()->LogError( string("PrimitiveParser::ParseXML invalid shooter state"), attr.value());
+                        if ( errors != nullptr )
                         {
-                            xloc = attr.as_float();
+                            errors->emplace_back( string("invalid shooter state ") + attr.value() );
                         }
-                        else if ( strcmp( attr.name(), "yloc" ) == 0 )
+                        hasError = true;
+                    }
+                }
+                else
+                {
+                    Logger::GetLogger()->LogError( string("PrimitiveParser::ParseXML invalid attribute"), attr.name());
+                    if ( errors != nullptr )
+                    {
+                        errors->emplace_back( string("invalid attribute ") + attr.name() );
+                    }
+                    hasError = true;
+                }
+            }
+            if ( !hasError )
+            {   
+                auto param = program->Add( PrimitiveParams( primitiveType,
+                                                            time,
+                                                            distance,
+                                                            xloc,
+                                                            yloc,
+                                                            headingOption,
+                                                            heading,
+                                                            startDriveSpeed,
+                                                            endDriveSpeed,
+                                                            pathName,
+                                                            leftIntakeState,
+                                                            rightIntakeState,
+                                                            shooterState ) );
+                if ( param != nullptr )
+                {
+                    param->SetGivenMechanismStates( hasLeftIntakeState, hasRightIntakeState, hasShooterState );
+                }
+                if ( !publish || param == nullptr )
+                {
+                    return;
+                }
+                string ntName = string("Primitive ") + to_string(program->Size());
+                auto logger = Logger::GetLogger();
+                logger->ToNtTable(ntName, string("Primitive ID"), to_string(param->GetID()));
+                logger->ToNtTable(ntName, string("Time"), param->GetTime());
+                logger->ToNtTable(ntName, string("Distance"), param->GetDistance());
+                logger->ToNtTable(ntName, string("X Location"), param->GetXLocation());
+                logger->ToNtTable(ntName, string("Y Location"), param->GetYLocation());
+                logger->ToNtTable(ntName, string("Heading Option"), to_string(param->GetHeadingOption()));
+                logger->ToNtTable(ntName, string("Heading"), param->GetHeading());
+                logger->ToNtTable(ntName, string("Drive Speed"), param->GetDriveSpeed());
+                logger->ToNtTable(ntName, string("End Drive Speed"), param->GetEndDriveSpeed());
+                logger->ToNtTable(ntName, string("Path Name"), param->GetPathName());
+                logger->ToNtTable(ntName, string("Left Intake"), to_string(param->GetLeftIntakeState()));
+                logger->ToNtTable(ntName, string("Right Intake"), to_string(param->GetRightIntakeState()));
+                logger->ToNtTable(ntName, string("Shooter"), to_string(param->GetShooterState()));
+            }
+            else 
+            {
+                 Logger::GetLogger() -> LogError( string("PrimitiveParser::ParseXML"), string("Has Error"));
+            }
+        };
+
+        // a group that can't run together fails the whole auton rather than running some of it
+        auto invalidGroup = false;
+        xml_node auton = doc.root();
+        for (xml_node node = auton.first_child(); node; node = node.next_sibling())
+        {
+            for (xml_node primitiveNode = node.first_child(); primitiveNode; primitiveNode = primitiveNode.next_sibling())
+            {
+                if ( strcmp( primitiveNode.name(), "primitive") == 0 )
+                {
+                    parsePrimitive( primitiveNode );
+                    continue;
+                }
+
+                // the primitives in a group run at the same time
+                auto groupType = AutonProgram::GROUP_TYPE::SINGLE;
+                if ( strcmp( primitiveNode.name(), "parallel") == 0 )
+                {
+                    groupType = AutonProgram::GROUP_TYPE::PARALLEL;
+                }
+                else if ( strcmp( primitiveNode.name(), "race") == 0 )
+                {
+                    groupType = AutonProgram::GROUP_TYPE::RACE;
+                }
+                else if ( strcmp( primitiveNode.name(), "deadline") == 0 )
+                {
+                    groupType = AutonProgram::GROUP_TYPE::DEADLINE;
+                }
+                else
+                {
+                    continue;
+                }
+
+                program->BeginGroup( groupType );
+                for (xml_node groupNode = primitiveNode.child("primitive"); groupNode; groupNode = groupNode.next_sibling("primitive"))
+                {
+                    parsePrimitive( groupNode );
+                }
+                auto group = program->EndGroup();
+                if ( group == nullptr )
+                {
+                    continue;
+                }
+
+                // only one primitive can drive the chassis and the primitive instances are shared, 
+                // so a group can't have two of the same type
+                auto driving = 0;
+                unsigned int types = 0;
+                for ( auto slot=group->first; slot<group->first+group->count; ++slot )
+                {
+                    auto id = program->GetParams( slot )->GetID();
+                    auto bit = 1U << (id - UNKNOWN_PRIMITIVE);
+                    driving += AutonProgram::DrivesChassis( id ) ? 1 : 0;
+                    if ( (types & bit) != 0 || driving > 1 )
+                    {
+                        string msg = (types & bit) != 0 ? string("group has two primitives of the same type") : 
+                                                          string("group has more than one primitive that drives the chassis");
+                        Logger::GetLogger()->LogError( string("PrimitiveParser::ParseXML"), msg );
+                        if ( errors != nullptr )
                         {
-                            yloc = attr.as_float();
+                            errors->emplace_back( msg + string(" (primitive ") + to_string(slot + 1) + string(")") );
                         }
-                        else if ( strcmp( attr.name(), "pathname") == 0)
-                        {
-                            pathName = attr.value();
-                        }                
-                        else if ( strcmp( attr.name(), "leftIntake" ) == 0 )
+                        invalidGroup = true;
+                        break;
+                    }
+                    types |= bit;
+                }
+
+                // the primitives in a group set the mechanisms at the same time, so they can't give a 
+                // mechanism different states
+                const PrimitiveParams* leftIntake = nullptr;
+                const PrimitiveParams* rightIntake = nullptr;
+                const PrimitiveParams* shooter = nullptr;
+                for ( auto slot=group->first; slot<group->first+group->count; ++slot )
+                {
+                    auto param = program->GetParams( slot );
+                    string mechanism;
+                    if ( param->HasLeftIntakeState() )
+                    {
+                        if ( leftIntake != nullptr && leftIntake->GetLeftIntakeState() != param->GetLeftIntakeState() )
                         {
-                            auto leftItr = LeftIntakeStateMgr::GetInstance()->m_intakeXmlStringToStateEnumMap.find( attr.value() );
-                            if ( leftItr != LeftIntakeStateMgr::GetInstance()->m_intakeXmlStringToStateEnumMap.end() )
-                            {
-                                leftIntakeState = leftItr->second;
-                            }
-                            else
-                            {
-                                Logger::GetLogger()->LogError( string("PrimitiveParser::ParseXML invalid left intake state"), attr.value());
-                                hasError = true;
-                            }
+                            mechanism = string("leftIntake");
                         }
-                        else if ( strcmp( attr.name(), "rightIntake" ) == 0 )
+                        leftIntake = param;
+                    }
+                    if ( param->HasRightIntakeState() )
+                    {
+                        if ( rightIntake != nullptr && rightIntake->GetRightIntakeState() != param->GetRightIntakeState() )
                         {
-                            auto rightItr = RightIntakeStateMgr::GetInstance()->m_intakeXmlStringToStateEnumMap.find( attr.value() );
-                            if ( rightItr != RightIntakeStateMgr::GetInstance()->m_intakeXmlStringToStateEnumMap.end() )
-                            {
-                                rightIntakeState = rightItr->second;
-                            }
-                            else
-                            {
-                                Logger::GetLogger()->LogError( string("PrimitiveParser::ParseXML invalid right intake state"), attr.value());
-                                hasError = true;
-                            }
+                            mechanism = string("rightIntake");
                         }
-                        else if ( strcmp( attr.name(), "shooter" ) == 0 )
+                        rightIntake = param;
+                    }
+                    if ( param->HasShooterState() )
+                    {
+                        if ( shooter != nullptr && shooter->GetShooterState() != param->GetShooterState() )
                         {
-                            auto shootItr = ShooterStateMgr::GetInstance()->m_shooterXmlStringToStateEnumMap.find( attr.value() );
-                            if ( shootItr != ShooterStateMgr::GetInstance()->m_shooterXmlStringToStateEnumMap.end() )
-                            {
-                                shooterState = shootItr->second;
-                            }
-                            else
-                            {
-                                Logger::GetLogger()->LogError( string("PrimitiveParser::ParseXML invalid shooter state"), attr.value());
-                                hasError = true;
-                            }
+                            mechanism = string("shooter");
                         }
-                        else
+                        shooter = param;
+                    }
+                    if ( !mechanism.empty() )
+                    {
+                        string msg = string("group gives ") + mechanism + string(" two different states");
+                        Logger::GetLogger()->LogError( string("PrimitiveParser::ParseXML"), msg );
+                        if ( errors != nullptr )
                         {
-                            Logger::GetLogger()->LogError( string("PrimitiveParser::ParseXML invalid attribute"), attr.name());
-                            hasError = true;
+                            errors->emplace_back( msg + string(" (primitive ") + to_string(slot + 1) + string(")") );
                         }
-                    }
-                    if ( !hasError )
-                    {   
-                        paramVector.emplace_back( new PrimitiveParams( primitiveType,
-                                                                       time,
-                                                                       distance,
-                                                                       xloc,
-                                                                       yloc,
-                                                                       headingOption,
-                                                                       heading,
-                                                                       startDriveSpeed,
-                                                                       endDriveSpeed,
-                                                                       pathName,
-                                                                       leftIntakeState,
-                                                                       rightIntakeState,
-                                                                       shooterState ) );
-                        string ntName = string("Primitive ") + to_string(paramVector.size());
-                        int slot = paramVector.size() - 1;
-                        auto logger = Logger::GetLogger();
-                        auto param = paramVector[slot];
-                        logger->ToNtTable(ntName, string("Primitive ID"), to_string(param->GetID()));
-                        logger->ToNtTable(ntName, string("Time"), param->GetTime());
-                        logger->ToNtTable(ntName, string("Distance"), param->GetDistance());
-                        logger->ToNtTable(ntName, string("X Location"), param->GetXLocation());
-                        logger->ToNtTable(ntName, string("Y Location"), param->GetYLocation());
-                        logger->ToNtTable(ntName, string("Heading Option"), to_string(param->GetHeadingOption()));
-                        logger->ToNtTable(ntName, string("Heading"), param->GetHeading());
-                        logger->ToNtTable(ntName, string("Drive Speed"), param->GetDriveSpeed());
-                        logger->ToNtTable(ntName, string("End Drive Speed"), param->GetEndDriveSpeed());
-                        logger->ToNtTable(ntName, string("Path Name"), param->GetPathName());
-                        logger->ToNtTable(ntName, string("Left Intake"), to_string(param->GetLeftIntakeState()));
-                        logger->ToNtTable(ntName, string("Right Intake"), to_string(param->GetRightIntakeState()));
-                        logger->ToNtTable(ntName, string("Shooter"), to_string(param->GetShooterState()));
-                    }
-                    else 
-                    {
-                         Logger::GetLogger() -> LogError( string("PrimitiveParser::ParseXML"), string("Has Error"));
+                        invalidGroup = true;
+                        break;
                     }
                 }
             }
         }
+
+        if ( invalidGroup )
+        {
+            Logger::GetLogger()->LogError( string("PrimitiveParser::ParseXML invalid group, not running"), fileName );
+            program = make_unique<AutonProgram>( 0 );
+        }
     }
     else
     {
         Logger::GetLogger()->LogError( string("PrimitiveParser::ParseXML error parsing file"), fileName );
         Logger::GetLogger()->LogError( string("PrimitiveParser::ParseXML error message"), result.description() );
+        if ( errors != nullptr )
+        {
+            errors->emplace_back( string("error parsing file: ") + result.description() );
+        }
+        program = make_unique<AutonProgram>( 0 );
     }
-    return paramVector;
+    return program;
 }
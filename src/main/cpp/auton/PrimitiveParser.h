@@ -17,20 +17,31 @@
 #pragma once
 
 // C++ Includes
+#include <memory>
+#include <string>
+#include <vector>
 
 // FRC includes
 
 // Team 302 includes
-#include <auton/PrimitiveParams.h>
+#include <auton/AutonProgram.h>
 
 // Third Party Includes
 
 class PrimitiveParser
 {
     public:
-        static PrimitiveParamsVector ParseXML
+        /// @brief  Parse an auton file from the deploy/auton directory
+        /// @param [in] std::string fileName - auton file (or an absolute path to one elsewhere, e.g. a test auton)
+        /// @param [out] std::vector<std::string>* errors - if not nullptr, the problems found are added to it
+        /// @param [in] bool publish - write the parsed primitives to the network table
+        /// @return std::unique_ptr<AutonProgram> - the primitives (never nullptr; empty if the file couldn't be parsed
+        ///                                         or has a group whose primitives can't run together)
+        static std::unique_ptr<AutonProgram> ParseXML
         (
-            std::string     fileName
+            std::string                 fileName,
+            std::vector<std::string>*   errors = nullptr,
+            bool                        publish = true
         );
 };
 
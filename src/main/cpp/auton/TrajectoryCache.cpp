@@ -0,0 +1,147 @@
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302 
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+// C++ Includes
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <string>
+
+// FRC includes
+#include <frc/Filesystem.h>
+#include <frc/trajectory/TrajectoryUtil.h>
+
+// Team 302 includes
+#include <auton/PathPlannerLoader.h>
+#include <auton/TrajectoryCache.h>
+#include <utils/Logger.h>
+
+// Third Party Includes
+
+using namespace std;
+
+TrajectoryCache* TrajectoryCache::m_instance = nullptr;
+
+TrajectoryCache* TrajectoryCache::GetInstance()
+{
+    // the plan builder and the auton validator threads can both be the first to ask for it
+    static once_flag created;
+    call_once(created, []() { TrajectoryCache::m_instance = new TrajectoryCache(); });
+    return TrajectoryCache::m_instance;
+}
+
+TrajectoryCache::TrajectoryCache() : m_mutex(),
+                                     m_trajectories()
+{
+}
+
+shared_ptr<const BinaryTrajectory> TrajectoryCache::GetTrajectory
+(
+    const string&   pathName
+)
+{
+    {
+        lock_guard<mutex> lock(m_mutex);
+        auto itr = m_trajectories.find(pathName);
+        if ( itr != m_trajectories.end() )
+        {
+            return itr->second;
+        }
+    }
+
+    // not preloaded, so read it now
+    Logger::GetLogger()->LogError(Logger::LOGGER_LEVEL::WARNING, string("TrajectoryCache::GetTrajectory"), pathName + string(" wasn't preloaded"));
+    Load(pathName);
+
+    lock_guard<mutex> lock(m_mutex);
+    auto itr = m_trajectories.find(pathName);
+    return itr != m_trajectories.end() ? itr->second : nullptr;
+}
+
+bool TrajectoryCache::Load
+(
+    const string&   pathName
+)
+{
+    if ( pathName.empty() )
+    {
+        return false;
+    }
+
+    if ( IsLoaded(pathName) )
+    {
+        return true;
+    }
+
+    // read the file without holding the lock, so the main loop isn't blocked by a background load
+    auto trajectory = ReadTrajectory(pathName);
+    if ( trajectory.get() != nullptr )
+    {
+        lock_guard<mutex> lock(m_mutex);
+        m_trajectories.try_emplace(pathName, trajectory);
+        return true;
+    }
+    return false;
+}
+
+bool TrajectoryCache::IsLoaded
+(
+    const string&   pathName
+)
+{
+    lock_guard<mutex> lock(m_mutex);
+    return m_trajectories.find(pathName) != m_trajectories.end();
+}
+
+shared_ptr<const BinaryTrajectory> TrajectoryCache::ReadTrajectory
+(
+    const string&   pathName
+) const
+{
+    // PathPlanner paths (X.path in deploy/pathplanner) are generated from their waypoints
+    auto pathPlannerExt = string(".path");
+    if ( pathName.size() > pathPlannerExt.size() && pathName.compare(pathName.size()-pathPlannerExt.size(), pathPlannerExt.size(), pathPlannerExt) == 0 )
+    {
+        return PathPlannerLoader::Load(frc::filesystem::GetDeployDirectory() + "/pathplanner/" + pathName);
+    }
+
+    auto deployDir = frc::filesystem::GetDeployDirectory();
+    deployDir += "/paths/" + pathName;
+
+    // use the binary conversion (X.wpilib.json -> X.wpilib.traj) if it was deployed
+    auto binaryFile = deployDir;
+    auto ext = string(".json");
+    if ( binaryFile.size() > ext.size() && binaryFile.compare(binaryFile.size()-ext.size(), ext.size(), ext) == 0 )
+    {
+        binaryFile.erase(binaryFile.size()-ext.size());
+    }
+    binaryFile += string(".traj");
+
+    auto binary = BinaryTrajectory::Load(binaryFile, deployDir);
+    if ( binary.get() != nullptr )
+    {
+        return binary;
+    }
+
+    try
+    {
+        return BinaryTrajectory::FromTrajectory(frc::TrajectoryUtil::FromPathweaverJson(deployDir));
+    }
+    catch(const std::exception& e)
+    {
+        Logger::GetLogger()->LogError(string("TrajectoryCache::ReadTrajectory"), string("unable to load ") + deployDir);
+    }
+    return nullptr;
+}
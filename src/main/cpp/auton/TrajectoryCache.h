@@ -0,0 +1,81 @@
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302 
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+#pragma once
+
+// C++ Includes
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+// FRC includes
+
+// Team 302 includes
+#include <auton/BinaryTrajectory.h>
+
+// Third Party Includes
+
+
+/// @class TrajectoryCache
+/// @brief Holds the trajectories that have been loaded from the deploy/paths directory so that each
+///        file is only read once.  The binary (.traj) conversion is memory-mapped when it is deployed;
+///        otherwise the Pathweaver JSON is parsed.  A name ending in .path is a PathPlanner path in the
+///        deploy/pathplanner directory; its states are generated by the PathPlannerLoader.  Trajectories can be preloaded from a
+///        background thread while the robot is disabled; the primitives then get them without any
+///        file I/O during the match.
+class TrajectoryCache
+{
+    public:
+        /// @brief  Find or create the singleton
+        /// @return TrajectoryCache* - the cache
+        static TrajectoryCache* GetInstance();
+
+        /// @brief  Get a trajectory, loading it if it isn't in the cache yet
+        /// @param [in] const std::string& pathName - file name in the deploy/paths directory
+        /// @return std::shared_ptr<const BinaryTrajectory> - trajectory (nullptr if it couldn't be loaded)
+        std::shared_ptr<const BinaryTrajectory> GetTrajectory
+        (
+            const std::string&      pathName
+        );
+
+        /// @brief  Load a trajectory into the cache (safe to call from a background thread)
+        /// @param [in] const std::string& pathName - file name in the deploy/paths directory
+        /// @return bool - true if the trajectory is in the cache
+        bool Load
+        (
+            const std::string&      pathName
+        );
+
+        /// @brief  Is the trajectory already loaded
+        bool IsLoaded
+        (
+            const std::string&      pathName
+        );
+
+    private:
+        TrajectoryCache();
+        ~TrajectoryCache() = default;
+
+        std::shared_ptr<const BinaryTrajectory> ReadTrajectory
+        (
+            const std::string&      pathName
+        ) const;
+
+        std::mutex                                                      m_mutex;
+        std::map<std::string, std::shared_ptr<const BinaryTrajectory>>   m_trajectories;
+
+        static TrajectoryCache*                                         m_instance;
+};
@@ -0,0 +1,143 @@
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302 
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+// C++ Includes
+#include <cstddef>
+#include <memory>
+
+// FRC includes
+#include <frc/geometry/Rotation2d.h>
+#include <frc/trajectory/Trajectory.h>
+
+// Team 302 includes
+#include <auton/BinaryTrajectory.h>
+#include <auton/TrajectorySampler.h>
+
+// Third Party Includes
+
+using namespace std;
+
+TrajectorySampler::TrajectorySampler() : m_trajectory(),
+                                         m_cursor(0)
+{
+}
+
+TrajectorySampler::TrajectorySampler
+(
+    shared_ptr<const BinaryTrajectory>  trajectory
+) : m_trajectory(trajectory),
+    m_cursor(0)
+{
+}
+
+void TrajectorySampler::SetTrajectory
+(
+    shared_ptr<const BinaryTrajectory>  trajectory
+)
+{
+    m_trajectory = trajectory;
+    m_cursor = 0;
+}
+
+frc::Trajectory::State TrajectorySampler::Sample
+(
+    units::second_t     t
+)
+{
+    if ( !HasTrajectory() )
+    {
+        return frc::Trajectory::State();
+    }
+
+    auto time = t.to<double>();
+    auto& trajectory = *m_trajectory.get();
+
+    // time went backwards (e.g. the timer was reset), so start over
+    if ( m_cursor >= trajectory.Size() || time < trajectory.GetState(m_cursor).time )
+    {
+        m_cursor = 0;
+    }
+    m_cursor = FindInterval(m_cursor, time);
+    return SampleFrom(m_cursor, time);
+}
+
+frc::Trajectory::State TrajectorySampler::SampleAhead
+(
+    units::second_t     t,
+    units::second_t     lookahead
+) const
+{
+    if ( !HasTrajectory() )
+    {
+        return frc::Trajectory::State();
+    }
+
+    auto time = (t + lookahead).to<double>();
+    auto start = ( m_cursor < m_trajectory.get()->Size() && time >= m_trajectory.get()->GetState(m_cursor).time ) ? m_cursor : 0;
+    return SampleFrom(FindInterval(start, time), time);
+}
+
+frc::Rotation2d TrajectorySampler::GetHolonomicRotation
+(
+    units::second_t     t
+) const
+{
+    if ( !HasTrajectory() )
+    {
+        return frc::Rotation2d();
+    }
+
+    auto time = t.to<double>();
+    auto start = ( m_cursor < m_trajectory.get()->Size() && time >= m_trajectory.get()->GetState(m_cursor).time ) ? m_cursor : 0;
+    return m_trajectory.get()->InterpolateHolonomicRotation(FindInterval(start, time), time);
+}
+
+bool TrajectorySampler::IsFinished
+(
+    units::second_t     t
+) const
+{
+    return !HasTrajectory() || t >= m_trajectory.get()->TotalTime();
+}
+
+size_t TrajectorySampler::FindInterval
+(
+    size_t      from,
+    double      time
+) const
+{
+    auto& trajectory = *m_trajectory.get();
+    auto last = trajectory.Size() - 1;
+    auto index = from;
+    while ( index < last && trajectory.GetState(index+1).time <= time )
+    {
+        index++;
+    }
+    return index;
+}
+
+frc::Trajectory::State TrajectorySampler::SampleFrom
+(
+    size_t      index,
+    double      time
+) const
+{
+    auto& trajectory = *m_trajectory.get();
+    if ( index >= trajectory.Size() - 1 || time <= trajectory.GetState(0).time )
+    {
+        return BinaryTrajectory::ToState(trajectory.GetState(index >= trajectory.Size() - 1 ? trajectory.Size() - 1 : 0));
+    }
+    return trajectory.Interpolate(index, time);
+}
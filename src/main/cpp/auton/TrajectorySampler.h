@@ -0,0 +1,108 @@
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302 
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+#pragma once
+
+// C++ Includes
+#include <cstddef>
+#include <memory>
+
+// FRC includes
+#include <frc/geometry/Rotation2d.h>
+#include <frc/trajectory/Trajectory.h>
+#include <units/time.h>
+
+// Team 302 includes
+#include <auton/BinaryTrajectory.h>
+
+// Third Party Includes
+
+
+/// @class TrajectorySampler
+/// @brief Samples a trajectory for a path follower.  Time normally only moves forward, so the sampler
+///        keeps a cursor on the current interval and walks it forward instead of searching the whole
+///        trajectory each loop (amortized O(1) per sample).  If time goes backwards it re-searches.
+///        The trajectory storage is shared, not copied.
+class TrajectorySampler
+{
+    public:
+        TrajectorySampler();
+        explicit TrajectorySampler
+        (
+            std::shared_ptr<const BinaryTrajectory>     trajectory
+        );
+        ~TrajectorySampler() = default;
+
+        /// @brief  Follow a new trajectory (the cursor goes back to the start)
+        void SetTrajectory
+        (
+            std::shared_ptr<const BinaryTrajectory>     trajectory
+        );
+
+        /// @brief  Move the cursor back to the start of the trajectory
+        void Reset() { m_cursor = 0; }
+
+        /// @brief  Interpolated state at a time; moves the cursor
+        /// @param [in] units::second_t t - time from the start of the trajectory
+        /// @return frc::Trajectory::State - state at that time (clamped to the ends)
+        frc::Trajectory::State Sample
+        (
+            units::second_t     t
+        );
+
+        /// @brief  Interpolated state a fixed time ahead of t; the cursor doesn't move
+        /// @param [in] units::second_t t - current time from the start of the trajectory
+        /// @param [in] units::second_t lookahead - how far ahead to sample
+        /// @return frc::Trajectory::State - state at t + lookahead (clamped to the end)
+        frc::Trajectory::State SampleAhead
+        (
+            units::second_t     t,
+            units::second_t     lookahead
+        ) const;
+
+        /// @brief  Holonomic rotation target at a time (call after Sample; the cursor doesn't move)
+        /// @param [in] units::second_t t - time from the start of the trajectory
+        /// @return frc::Rotation2d - heading the robot should have
+        frc::Rotation2d GetHolonomicRotation
+        (
+            units::second_t     t
+        ) const;
+
+        /// @brief  Is the time at or past the end of the trajectory
+        bool IsFinished
+        (
+            units::second_t     t
+        ) const;
+
+        size_t GetCursor() const { return m_cursor; }
+        bool HasTrajectory() const { return m_trajectory.get() != nullptr && !m_trajectory.get()->Empty(); }
+
+    private:
+        /// @brief  Index of the state that starts the interval containing the time, searching forward from a state
+        size_t FindInterval
+        (
+            size_t              from,
+            double              time
+        ) const;
+
+        frc::Trajectory::State SampleFrom
+        (
+            size_t              index,
+            double              time
+        ) const;
+
+        std::shared_ptr<const BinaryTrajectory>     m_trajectory;
+        size_t                                      m_cursor;
+};
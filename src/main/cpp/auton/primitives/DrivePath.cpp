@@ -26,6 +26,7 @@
 
 // 302 Includes
 #include <auton/primitives/DrivePath.h>
+#include <auton/TrajectoryCache.h>
 #include <subsys/ChassisFactory.h>
 #include <utils/Logger.h>
 
@@ -39,6 +40,7 @@ DrivePath::DrivePath() : m_chassis(ChassisFactory::GetChassisFactory()->GetIChas
                          m_timer(make_unique<Timer>()),
                          m_currentChassisPosition(m_chassis.get()->GetPose()),
                          m_trajectory(),
+                         m_sampler(),
                          m_runHoloController(true),
                          m_ramseteController(),
                          m_holoController(frc2::PIDController{1.5, 0, 0},
@@ -52,14 +54,14 @@ DrivePath::DrivePath() : m_chassis(ChassisFactory::GetChassisFactory()->GetIChas
                          m_targetPose(),
                          m_deltaX(0.0),
                          m_deltaY(0.0),
-                         m_trajectoryStates(),
                          m_desiredState(),
+                         m_desiredRotation(),
                          m_headingOption(IChassis::HEADING_OPTION::MAINTAIN),
                          m_heading(0.0),
-                         m_maxTime(-1.0)
+                         m_maxTime(-1.0),
+                         m_whyDone(nullptr)
 
 {
-    m_trajectoryStates.clear();
 }
 void DrivePath::Init(PrimitiveParams *params)
 {
@@ -67,6 +69,7 @@ void DrivePath::Init(PrimitiveParams *params)
     m_headingOption = params->GetHeadingOption();
     m_heading = params->GetHeading();
     m_maxTime = params->GetTime();
+    m_whyDone = nullptr;
 
     Logger::GetLogger()->LogError(string("DrivePathInit"), string(m_pathname));
 
@@ -78,7 +81,8 @@ void DrivePath::Init(PrimitiveParams *params)
     Logger::GetLogger()->ToNtTable("DrivePath" + m_pathname, "WhyDone", "Not done");
     Logger::GetLogger()->ToNtTable("DrivePath" + m_pathname, "Times Ran", 0);
 
-    m_trajectoryStates.clear(); //Clears the primitive of previous path/trajectory
+    m_trajectory.reset(); //Clears the primitive of previous path/trajectory
+    m_sampler.SetTrajectory(m_trajectory);
 
     m_wasMoving = false;
 
@@ -86,13 +90,13 @@ void DrivePath::Init(PrimitiveParams *params)
 
     GetTrajectory(params->GetPathName());  //Parses path from json file based on path name given in xml
     
-    Logger::GetLogger()->ToNtTable(m_pathname + "Trajectory", "Time", m_trajectory.TotalTime().to<double>());// Debugging
+    Logger::GetLogger()->ToNtTable(m_pathname + "Trajectory", "Time", HasTrajectory() ? m_trajectory.get()->TotalTime().to<double>() : 0.0);// Debugging
 
-    Logger::GetLogger()->LogError(string("DrivePathInit"), to_string(m_trajectoryStates.size()));
+    Logger::GetLogger()->LogError(string("DrivePathInit"), to_string(HasTrajectory() ? m_trajectory.get()->Size() : 0));
     
-    if (!m_trajectoryStates.empty()) // only go if path name found
+    if (HasTrajectory()) // only go if path name found
     {
-        m_desiredState = m_trajectoryStates.front(); //m_desiredState is the first state, or starting position
+        m_desiredState = BinaryTrajectory::ToState(m_trajectory.get()->GetState(0)); //m_desiredState is the first state, or starting position
 
         m_timer.get()->Reset(); //Restarts and starts timer
         m_timer.get()->Start();
@@ -114,7 +118,7 @@ void DrivePath::Init(PrimitiveParams *params)
 
         //Sampling means to grab a state based on the time, if we want to know what state we should be running at 5 seconds,
         //we will sample the 5 second state.
-        auto targetState = m_trajectory.Sample(m_trajectory.TotalTime());  //"Samples" or grabs the position we should be at based on time
+        auto targetState = m_trajectory.get()->Sample(m_trajectory.get()->TotalTime());  //"Samples" or grabs the position we should be at based on time
 
         m_targetPose = targetState.pose;  //Target pose represents the pose that we want to be at, based on the target state from above
 
@@ -132,7 +136,7 @@ void DrivePath::Run()
 {
     Logger::GetLogger()->ToNtTable("DrivePath" + m_pathname, "Running", "True");
 
-    if (!m_trajectoryStates.empty()) //If we have a path parsed / have states to run
+    if (HasTrajectory()) //If we have a path parsed / have states to run
     {
         // debugging
         m_timesRun++;
@@ -187,7 +191,7 @@ void DrivePath::Run()
             Logger::GetLogger()->ToNtTable("DrivePathValues", "desired pose omega", m_desiredState.pose.Rotation().Degrees().to<double>());
             refChassisSpeeds = m_holoController.Calculate(m_currentChassisPosition, 
                                                           m_desiredState, 
-                                                          m_desiredState.pose.Rotation());
+                                                          m_desiredRotation);
         }
         else
         {
@@ -230,15 +234,19 @@ bool DrivePath::IsDone() //Default primitive function to determine if the primit
 {
 
     bool isDone = false;
-    string whyDone = ""; //debugging variable that we used to determine why the path was stopping
+    const char* whyDone = ""; //debugging variable that we used to determine why the path was stopping
     
-    if (!m_trajectoryStates.empty()) //If we have states... 
+    if (HasTrajectory()) //If we have states... 
     {
         auto curPos = m_chassis.get()->GetPose();
         // allow a time out to be put into the xml
         auto currentTime = m_timer.get()->Get().to<double>();
         isDone = currentTime > m_maxTime && m_maxTime > 0.0;
-        if (!isDone)
+        if (isDone)
+        {
+            whyDone = "Timed out";
+        }
+        else
         {
             // Check if the current pose and the trajectory's final pose are the same
             //isDone = IsSamePose(curPos, m_targetPose, 100.0);
@@ -299,13 +307,15 @@ bool DrivePath::IsDone() //Default primitive function to determine if the primit
     else
     {
         Logger::GetLogger()->ToNtTable("DrivePath" + m_pathname, "Done", "True");
+        m_whyDone = "No trajectory";
         return true;
     }
     if (isDone)
     {   //debugging
+        m_whyDone = whyDone;
         Logger::GetLogger()->ToNtTable("DrivePath" + m_pathname, "Done", "True");
         Logger::GetLogger()->ToNtTable("DrivePath" + m_pathname, "WhyDone", whyDone);
-        Logger::GetLogger()->LogError(Logger::LOGGER_LEVEL::PRINT, "DrivePath" + m_pathname, "Is done because: " + whyDone);
+        Logger::GetLogger()->LogError(Logger::LOGGER_LEVEL::PRINT, "DrivePath" + m_pathname, string("Is done because: ") + whyDone);
     }
     return isDone;
     
@@ -336,27 +346,18 @@ void DrivePath::GetTrajectory //Parses pathweaver json to create a series of poi
 {
     if (!path.empty()) // only go if path name found
     {
-        Logger::GetLogger()->LogError(string("DrivePath" + m_pathname), string("Finding Deploy Directory"));
-
-        // Read path into trajectory for deploy directory.  JSON File ex. Bounce1.wpilid.json
-        //wpi::SmallString<64> deployDir;  //creates a string variable
-        //frc::filesystem::GetDeployDirectory(deployDir);  //grabs the deploy directory: "/lvuser/deploy" on roborio
-        //wpi::sys::path::append(deployDir, "paths");  //goes into "/lvuser/deploy/paths" on roborio
-        //wpi::sys::path::append(deployDir, path); // load path from deploy directory
-    	auto deployDir = frc::filesystem::GetDeployDirectory();
-        deployDir += "/paths/" + path;
-
-        m_trajectory = frc::TrajectoryUtil::FromPathweaverJson(deployDir);
-
-        Logger::GetLogger()->LogError(string("Deploy path is "), deployDir.c_str()); //Debugging
-        
-        //This doesn't work, gives parsing error
-        m_trajectory = frc::TrajectoryUtil::FromPathweaverJson(deployDir);  //Creates a trajectory or path that can be used in the code, parsed from pathweaver json
-        //m_trajectory = frc::TrajectoryUtil::FromPathweaverJson("/home/lvuser/deploy/paths/5Ball1.wpilib.json"); //This is a temporary fix
-        m_trajectoryStates = m_trajectory.States();  //Creates a vector of all the states or "waypoints" the robot needs to get to
+        // The trajectory is normally preloaded into the cache while disabled, so there is no file I/O here.
+        // JSON File ex. Bounce1.wpilib.json in "/home/lvuser/deploy/paths"
+        auto trajectory = TrajectoryCache::GetInstance()->GetTrajectory(path);
+        if (trajectory.get() == nullptr)
+        {
+            return;
+        }
+        m_trajectory = trajectory;  //The states or "waypoints" the robot needs to get to (not copied)
+        m_sampler.SetTrajectory(m_trajectory);
         
         Logger::GetLogger()->LogError(string("DrivePath - Loaded = "), path);
-        Logger::GetLogger()->ToNtTable("DrivePathValues", "TrajectoryTotalTime", m_trajectory.TotalTime().to<double>());
+        Logger::GetLogger()->ToNtTable("DrivePathValues", "TrajectoryTotalTime", m_trajectory.get()->TotalTime().to<double>());
     }
 
 }
@@ -366,7 +367,8 @@ void DrivePath::CalcCurrentAndDesiredStates()
     m_currentChassisPosition = m_chassis.get()->GetPose(); //Grabs current pose / position
     auto sampleTime = units::time::second_t(m_timer.get()->Get()); //+ 0.02  //Grabs the time that we should sample a state from
 
-    m_desiredState = m_trajectory.Sample(sampleTime); //Gets the target state based on the current time
+    m_desiredState = m_sampler.Sample(sampleTime); //Gets the target state based on the current time (walks forward from the last sample)
+    m_desiredRotation = m_trajectory.get()->IsHolonomic() ? m_sampler.GetHolonomicRotation(sampleTime) : m_desiredState.pose.Rotation(); //PathPlanner paths have their own heading targets
 
     // May need to do our own sampling based on position and time     
 
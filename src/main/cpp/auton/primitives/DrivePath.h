@@ -18,7 +18,9 @@
 #include <memory>
 
 //Team302 Includes
+#include <auton/BinaryTrajectory.h>
 #include <auton/PrimitiveParams.h>
+#include <auton/TrajectorySampler.h>
 #include <auton/primitives/IPrimitive.h>
 #include <states/chassis/DragonTargetFinder.h>
 #include <subsys/ChassisFactory.h>
@@ -53,11 +55,13 @@ public:
     void Init(PrimitiveParams *params) override;
     void Run() override;
     bool IsDone() override;
+    const char* GetDoneReason() const override { return m_whyDone; }
 
 private:
     bool IsSamePose(frc::Pose2d, frc::Pose2d, double tolerance); // routine to check for motion
     void GetTrajectory(std::string  path);
     void CalcCurrentAndDesiredStates();
+    bool HasTrajectory() const { return m_trajectory.get() != nullptr && !m_trajectory.get()->Empty(); }
 
 
 
@@ -65,7 +69,8 @@ private:
     std::unique_ptr<frc::Timer>             m_timer;
 
     frc::Pose2d                             m_currentChassisPosition;
-    frc::Trajectory                         m_trajectory;
+    std::shared_ptr<const BinaryTrajectory> m_trajectory;
+    TrajectorySampler                       m_sampler;
     bool                                    m_runHoloController;
     bool                                    m_wasMoving;
     frc::RamseteController                  m_ramseteController;
@@ -77,12 +82,13 @@ private:
     std::string                             m_pathname;
     double                                  m_deltaX;
     double                                  m_deltaY;
-    std::vector<frc::Trajectory::State>     m_trajectoryStates;
     frc::Trajectory::State                  m_desiredState;
+    frc::Rotation2d                         m_desiredRotation;  // heading target for the holonomic controller
     IChassis::HEADING_OPTION                m_headingOption;
     double                                  m_heading;
     DragonTargetFinder                      m_targetFinder;
     double                                  m_maxTime;
+    const char*                             m_whyDone;          // why IsDone returned true (nullptr until then)
 
  
 };
\ No newline at end of file
@@ -0,0 +1,97 @@
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302 
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+//C++ Includes
+#include <string>
+
+//FRC Includes
+#include <frc/geometry/Pose2d.h>
+#include <frc/geometry/Rotation2d.h>
+#include <frc/kinematics/ChassisSpeeds.h>
+#include <units/angle.h>
+#include <units/angular_velocity.h>
+#include <units/length.h>
+#include <units/velocity.h>
+
+// 302 Includes
+#include <auton/PrimitiveParams.h>
+#include <auton/primitives/DriveToPose.h>
+#include <subsys/ChassisFactory.h>
+#include <utils/Logger.h>
+
+using namespace std;
+using namespace frc;
+
+DriveToPose::DriveToPose() : m_chassis(ChassisFactory::GetChassisFactory()->GetIChassis()),
+                             m_follower(),
+                             m_timer(),
+                             m_headingOption(IChassis::HEADING_OPTION::MAINTAIN),
+                             m_maxTime(-1.0)
+{
+}
+
+void DriveToPose::Init(PrimitiveParams* params)
+{
+    Pose2d target(units::length::meter_t(params->GetXLocation()),
+                  units::length::meter_t(params->GetYLocation()),
+                  Rotation2d(units::angle::degree_t(params->GetHeading())));
+    m_headingOption = params->GetHeadingOption();
+    m_maxTime = params->GetTime();
+
+    m_follower.Start(target);
+
+    m_timer.Reset();
+    m_timer.Start();
+
+    Logger::GetLogger()->ToNtTable(string("DriveToPose"), string("TargetX"), target.X().to<double>());
+    Logger::GetLogger()->ToNtTable(string("DriveToPose"), string("TargetY"), target.Y().to<double>());
+}
+
+void DriveToPose::Run()
+{
+    if (m_chassis == nullptr)
+    {
+        return;
+    }
+
+    ChassisSpeeds speeds;
+    if (m_follower.Calculate(speeds))
+    {
+        m_chassis->Drive(speeds,
+                         IChassis::CHASSIS_DRIVE_MODE::ROBOT_ORIENTED,
+                         m_headingOption);
+    }
+    else //Hold while the trajectory is being generated
+    {
+        speeds.vx = 0_mps;
+        speeds.vy = 0_mps;
+        speeds.omega = units::angular_velocity::radians_per_second_t(0);
+        m_chassis->Drive(speeds,
+                         IChassis::CHASSIS_DRIVE_MODE::ROBOT_ORIENTED,
+                         IChassis::HEADING_OPTION::DEFAULT);
+    }
+    Logger::GetLogger()->ToNtTable(string("DriveToPose"), string("Following"), m_follower.IsFollowing() ? string("True") : string("False"));
+}
+
+bool DriveToPose::IsDone()
+{
+    auto timedOut = m_maxTime > 0.0 && m_timer.Get().to<double>() > m_maxTime;
+    auto done = m_chassis == nullptr || m_follower.IsDone() || timedOut;
+    if (done)
+    {
+        m_follower.Stop();
+    }
+    return done;
+}
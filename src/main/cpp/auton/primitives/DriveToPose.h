@@ -0,0 +1,54 @@
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302 
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+#pragma once
+
+//C++ Includes
+#include <memory>
+
+//FRC/WPI Includes
+#include <frc/Timer.h>
+
+//Team 302 Includes
+#include <auton/PoseFollower.h>
+#include <auton/primitives/IPrimitive.h>
+#include <subsys/interfaces/IChassis.h>
+
+//Forward Declares
+class PrimitiveParams;
+
+/// @class DriveToPose
+/// @brief Drive from wherever the robot is to the pose given by xloc, yloc (meters) and heading
+///        (degrees).  The trajectory is generated in the background; the robot holds until it is ready.
+class DriveToPose : public IPrimitive
+{
+    public:
+        DriveToPose();
+
+        virtual ~DriveToPose() = default;
+
+        void Init(PrimitiveParams* params) override;
+
+        void Run() override;
+
+        bool IsDone() override;
+
+    private:
+        IChassis*                   m_chassis;
+        PoseFollower                m_follower;
+        frc::Timer                  m_timer;
+        IChassis::HEADING_OPTION    m_headingOption;
+        double                      m_maxTime;
+};
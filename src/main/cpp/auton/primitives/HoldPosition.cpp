@@ -25,6 +25,7 @@
 #include <auton/PrimitiveParams.h>
 #include <auton/primitives/HoldPosition.h>
 #include <auton/primitives/IPrimitive.h>
+#include <controllers/ControlData.h>
 #include <controllers/ControlModes.h>
 #include <subsys/ChassisFactory.h>
 
@@ -36,7 +37,19 @@ using namespace frc;
 
 HoldPosition::HoldPosition() :
 		m_chassis( ChassisFactory::GetChassisFactory()->GetIChassis()), //Get chassis from chassis factory
-		m_timeRemaining(0.0)       //Value will be changed in init
+		m_timeRemaining(0.0),       //Value will be changed in init
+		m_controlData( ControlModes::CONTROL_TYPE::POSITION_INCH,
+		               ControlModes::CONTROL_RUN_LOCS::MOTOR_CONTROLLER,
+		               string("HoldPosition"),
+		               10.0,
+		               0.0,
+		               0.0,
+		               0.0,
+		               0.0,
+		               0.0,
+		               0.0,
+		               1.0,
+		               0.0 )
 {
 }
 
@@ -44,19 +57,7 @@ void HoldPosition::Init(PrimitiveParams* params) {
 
 	//Get timeRemaining from m_params
 	m_timeRemaining = params->GetTime();
-	auto cd = make_shared<ControlData>( ControlModes::CONTROL_TYPE::POSITION_INCH, 
-							   			ControlModes::CONTROL_RUN_LOCS::MOTOR_CONTROLLER,
-							   			string("HoldPosition"),
-							   			10.0,
-							   			0.0,
-							   			0.0,
-							   			0.0,
-							   			0.0,
-							   			0.0,
-							   			0.0,
-							   			1.0,
-							  			0.0   );
-	//m_chassis->SetControlConstants( cd.get() );
+	//m_chassis->SetControlConstants( &m_controlData );
 	//auto left = m_chassis->GetCurrentLeftPosition();
 	//auto right = m_chassis->GetCurrentRightPosition();
 
@@ -26,6 +26,7 @@
 // Third Party Includes
 
 #include <auton/primitives/IPrimitive.h>
+#include <controllers/ControlData.h>
 
 class IChassis;
 class PrimitiveParams;
@@ -47,5 +48,6 @@ private:
 	//Objects
 	std::shared_ptr<IChassis> m_chassis;
 	double m_timeRemaining; //In seconds
+	ControlData m_controlData; //built once, not on every Init
 };
 
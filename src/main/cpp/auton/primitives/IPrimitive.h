@@ -29,5 +29,9 @@ class IPrimitive
         virtual void Run() = 0;
         virtual bool IsDone() = 0;
 
+        /// @brief  Why the primitive is done (for the auton timeline)
+        /// @return const char* - reason, or nullptr if the primitive doesn't say
+        virtual const char* GetDoneReason() const { return nullptr; }
+
 };
 
@@ -21,6 +21,7 @@
 
 //Team 302 includes
 #include <auton/primitives/ResetPosition.h>
+#include <auton/TrajectoryCache.h>
 #include <auton/PrimitiveParams.h>
 #include <auton/primitives/IPrimitive.h>
 #include <subsys/ChassisFactory.h>
@@ -36,21 +37,20 @@ ResetPosition::ResetPosition() : m_chassis(ChassisFactory::GetChassisFactory()->
 
 void ResetPosition::Init(PrimitiveParams* params)
 {
-    string pathToLoad = params->GetPathName();
+    const string& pathToLoad = params->GetPathName();
 
-    if (pathToLoad != "")
+    auto trajectory = pathToLoad != "" ? TrajectoryCache::GetInstance()->GetTrajectory(pathToLoad) : nullptr;
+    if (trajectory.get() != nullptr)
     {
- 	    auto deployDir = frc::filesystem::GetDeployDirectory();
-        deployDir += "/paths/" + pathToLoad;
-        m_trajectory = frc::TrajectoryUtil::FromPathweaverJson(deployDir);
+        m_trajectory = trajectory;
 
-        m_chassis->ResetPosition(m_trajectory.InitialPose());
+        m_chassis->ResetPosition(m_trajectory.get()->InitialPose());
 
         Logger::GetLogger()->ToNtTable(string("Auton Info"), string("ResetPosX"), m_chassis.get()->GetPose().X().to<double>());
         Logger::GetLogger()->ToNtTable(string("Auton Info"), string("ResetPosY"), m_chassis.get()->GetPose().Y().to<double>());
-        Logger::GetLogger()->ToNtTable(string("Auton Info"), string("InitialPoseX"), m_trajectory.InitialPose().X().to<double>());
-        Logger::GetLogger()->ToNtTable(string("Auton Info"), string("InitialPoseY"), m_trajectory.InitialPose().Y().to<double>());
-        Logger::GetLogger()->ToNtTable(string("Auton Info"), string("InitialPoseOmega"), m_trajectory.InitialPose().Rotation().Degrees().to<double>());
+        Logger::GetLogger()->ToNtTable(string("Auton Info"), string("InitialPoseX"), m_trajectory.get()->InitialPose().X().to<double>());
+        Logger::GetLogger()->ToNtTable(string("Auton Info"), string("InitialPoseY"), m_trajectory.get()->InitialPose().Y().to<double>());
+        Logger::GetLogger()->ToNtTable(string("Auton Info"), string("InitialPoseOmega"), m_trajectory.get()->InitialPose().Rotation().Degrees().to<double>());
         
     }
 }
@@ -25,6 +25,7 @@
 #include <wpi/SmallString.h>
 
 //Team 302 Includes
+#include <auton/BinaryTrajectory.h>
 #include <auton/primitives/IPrimitive.h>
 
 //Forward Declares
@@ -46,5 +47,5 @@ class ResetPosition : public IPrimitive
     
     private:
         std::shared_ptr<IChassis> m_chassis;
-        frc::Trajectory                m_trajectory;
+        std::shared_ptr<const BinaryTrajectory> m_trajectory;
 };
\ No newline at end of file
@@ -0,0 +1,59 @@
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302 
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+// C++ Includes
+#include <memory>
+
+// FRC includes
+#include <frc/Timer.h>
+
+// Team 302 includes
+#include <auton/primitives/RunMechanisms.h>
+#include <auton/PrimitiveParams.h>
+#include <auton/primitives/IPrimitive.h>
+
+// Third Party Includes
+
+using namespace std;
+using namespace frc;
+
+/// @brief constructor that creates/initializes the object
+RunMechanisms::RunMechanisms() : m_maxTime(0.0),
+								 m_timer( make_unique<Timer>() )
+{
+}
+
+/// @brief initialize this usage of the primitive
+/// @param PrimitiveParms* params the primitive parameters
+/// @return void
+void RunMechanisms::Init(PrimitiveParams* params) 
+{
+	m_maxTime = params->GetTime();
+	m_timer->Reset();
+	m_timer->Start();
+}
+
+/// @brief run the primitive (periodic routine)
+/// @return void
+void RunMechanisms::Run() 
+{
+}
+
+/// @brief check if the time has run out
+/// @return bool true means the end condition was reached, false means it hasn't
+bool RunMechanisms::IsDone() 
+{
+	return m_timer->AdvanceIfElapsed(units::second_t(m_maxTime));
+}
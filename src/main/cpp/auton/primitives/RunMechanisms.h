@@ -0,0 +1,68 @@
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302 
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+#pragma once
+
+// C++ Includes
+#include <memory>
+
+// FRC includes
+
+// Team 302 includes
+#include <auton/primitives/IPrimitive.h>
+
+// Third Party Includes
+
+// forward declares
+class PrimitiveParams;
+
+namespace frc
+{
+	class Timer;
+}
+
+//========================================================================================================
+/// @class  RunMechanisms
+/// @brief  This is an auton primitive that only sets the intake and shooter states from its attributes
+///         and waits for its time;  it doesn't command the chassis, so it can run in a group alongside
+///         a drive primitive (e.g. spin up the shooter while turning).
+//========================================================================================================
+
+class RunMechanisms : public IPrimitive 
+{
+	public:
+		/// @brief constructor that creates/initializes the object
+		RunMechanisms();
+
+		/// @brief destructor, clean  up the memory from this object
+		virtual ~RunMechanisms() = default;
+
+		/// @brief initialize this usage of the primitive
+		/// @param PrimitiveParms* params the primitive parameters
+		/// @return void
+		void Init(PrimitiveParams* params) override;
+		
+		/// @brief run the primitive (periodic routine);  the state managers are run by CyclePrimitives
+		/// @return void
+		void Run() override;
+
+		/// @brief check if the time has run out
+		/// @return bool true means the end condition was reached, false means it hasn't
+		bool IsDone() override;
+
+	private:
+		float 						m_maxTime;		//Target time
+		std::unique_ptr<frc::Timer> m_timer;
+};
@@ -52,7 +52,19 @@ SuperDrive::SuperDrive() : m_chassis( ChassisFactory::GetChassisFactory()->GetIC
 						   m_accelDecelTime(0),
 						   m_currentTime(0),
 						   m_minSpeedSlowdown(0),
-						   m_kinematics(new frc::DifferentialDriveKinematics(ChassisFactory::GetChassisFactory()->GetIChassis()->GetTrack()))
+						   m_kinematics(new frc::DifferentialDriveKinematics(ChassisFactory::GetChassisFactory()->GetIChassis()->GetTrack())),
+						   m_controlData( ControlModes::CONTROL_TYPE::PERCENT_OUTPUT,
+						                  ControlModes::CONTROL_RUN_LOCS::MOTOR_CONTROLLER,
+						                  string("SuperDrive"),
+						                  12.0,
+						                  0.0,
+						                  0.0,
+						                  0.0,
+						                  0.0,
+						                  0.0,
+						                  0.0,
+						                  1.0,
+						                  0.0 )
 {
 }
 
@@ -104,19 +116,7 @@ void SuperDrive::Init(PrimitiveParams* params)
 	{
 		m_startHeading = pigeon->GetYaw();
 	}
-	auto cd = make_shared<ControlData>( ControlModes::CONTROL_TYPE::PERCENT_OUTPUT, 
-							   			ControlModes::CONTROL_RUN_LOCS::MOTOR_CONTROLLER,
-							   			string("SuperDrive"),
-							   			12.0,
-							   			0.0,
-							   			0.0,
-							   			0.0,
-							   			0.0,
-							   			0.0,
-							   			0.0,
-							   			1.0,
-							  			0.0   );
-	//m_chassis->SetControlConstants( cd.get() );
+	//m_chassis->SetControlConstants( &m_controlData );
 	//m_leftSpeed = m_targetSpeed > 0.0 ? 0.2 : -0.2;
 	//m_rightSpeed = m_targetSpeed > 0.0 ? 0.2 : -0.2;
 	//m_chassis->SetOutput( ControlModes::CONTROL_TYPE::PERCENT_OUTPUT, m_leftSpeed, m_rightSpeed );
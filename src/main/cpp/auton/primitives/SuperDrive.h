@@ -24,6 +24,7 @@
 
 // Team 302 includes
 #include <auton/primitives/IPrimitive.h>
+#include <controllers/ControlData.h>
 
 // Third Party Includes
 
@@ -77,5 +78,6 @@ protected:
 		double m_currentTime;
 		double m_minSpeedSlowdown;
 		frc::DifferentialDriveKinematics* m_kinematics;
+		ControlData m_controlData; //built once, not on every Init
 };
 
@@ -29,6 +29,7 @@
 #include <auton/PrimitiveParams.h>
 #include <auton/primitives/IPrimitive.h>
 #include <subsys/ChassisFactory.h>
+#include <controllers/ControlData.h>
 #include <controllers/ControlModes.h>
 #include <subsys/interfaces/IChassis.h>
 #include <hw/factories/PigeonFactory.h>
@@ -50,7 +51,19 @@ TurnAngle::TurnAngle() : m_chassis( ChassisFactory::GetChassisFactory()->GetICha
 						 m_rightPos(0.0),
 						 m_isDone(false),
 						 m_pigeon(PigeonFactory::GetFactory()->GetPigeon(DragonPigeon::PIGEON_USAGE::CENTER_OF_ROBOT)),
-						 m_heading(0.0)
+						 m_heading(0.0),
+						 m_controlData( ControlModes::CONTROL_TYPE::POSITION_INCH,
+						                ControlModes::CONTROL_RUN_LOCS::MOTOR_CONTROLLER,
+						                string("TurnAngle"),
+						                3.0,
+						                0.0,
+						                0.0,
+						                0.0,
+						                0.0,
+						                0.0,
+						                0.0,
+						                1.0,
+						                0.0 )
 {
 }
 
@@ -65,19 +78,6 @@ void TurnAngle::Init(PrimitiveParams* params)
 		m_targetAngle = startHeading + params->GetHeading();
 	}
 
-	auto cd = make_shared<ControlData>( ControlModes::CONTROL_TYPE::POSITION_INCH, 
-									ControlModes::CONTROL_RUN_LOCS::MOTOR_CONTROLLER,
-									string("TurnAngle"),
-									3.0,
-									0.0,
-									0.0,
-									0.0,
-									0.0,
-									0.0,
-									0.0,
-									1.0,
-									0.0   );
-
 	m_maxTime = params->GetTime();
 	m_timer->Reset();
 	m_timer->Start();
@@ -23,6 +23,7 @@
 
 // Team 302 includes
 #include <auton/primitives/IPrimitive.h>
+#include <controllers/ControlData.h>
 #include <hw/DragonPigeon.h>
 
 // Third Party Includes
@@ -66,5 +67,6 @@ class TurnAngle : public IPrimitive
 
         DragonPigeon*                   m_pigeon;
         double                          m_heading;
+        ControlData                     m_controlData;  // built once, not on every Init
 };
 
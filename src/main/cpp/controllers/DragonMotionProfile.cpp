@@ -0,0 +1,182 @@
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302 
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+// C++ Includes
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Team 302 includes
+#include <controllers/ControlData.h>
+#include <controllers/DragonMotionProfile.h>
+#include <controllers/MotionProfilePoint.h>
+#include <hw/interfaces/IDragonMotorController.h>
+#include <utils/Logger.h>
+
+using namespace std;
+
+DragonMotionProfile::DragonMotionProfile
+(
+    shared_ptr<IDragonMotorController>  motor,
+    string                              ntName
+) : m_motor(motor),
+    m_ntName(ntName),
+    m_progress({false, false, false, 0}),
+    m_totalPoints(0),
+    m_underruns(0)
+{
+    if ( motor.get() == nullptr )
+    {
+        Logger::GetLogger()->LogError( string("DragonMotionProfile::DragonMotionProfile"), string("no motor"));
+    }
+}
+
+vector<MotionProfilePoint> DragonMotionProfile::Generate
+(
+    double      start,
+    double      target,
+    double      cruiseVelocity,
+    double      maxAcceleration,
+    int         periodMs
+)
+{
+    vector<MotionProfilePoint> points;
+    if ( cruiseVelocity <= 0.0 || maxAcceleration <= 0.0 || periodMs <= 0 )
+    {
+        return points;
+    }
+
+    auto direction = target >= start ? 1.0 : -1.0;
+    auto distance  = abs(target - start);
+
+    // accelerate to the cruise velocity, cruise, then decelerate;  if the move is too short to 
+    // reach the cruise velocity it becomes a triangle profile
+    auto accelTime   = cruiseVelocity / maxAcceleration;
+    auto accelDist   = 0.5 * maxAcceleration * accelTime * accelTime;
+    auto peakVel     = cruiseVelocity;
+    auto cruiseTime  = 0.0;
+    if ( 2.0 * accelDist > distance )
+    {
+        accelTime = sqrt(distance / maxAcceleration);
+        accelDist = 0.5 * distance;
+        peakVel   = maxAcceleration * accelTime;
+    }
+    else
+    {
+        cruiseTime = (distance - 2.0 * accelDist) / cruiseVelocity;
+    }
+    auto totalTime = 2.0 * accelTime + cruiseTime;
+    auto period    = periodMs / 1000.0;
+
+    points.reserve(static_cast<size_t>(ceil(totalTime / period)) + 1);
+    for ( auto time = period; ; time += period )
+    {
+        time = min(time, totalTime);
+
+        double pos = 0.0;
+        double vel = 0.0;
+        if ( time < accelTime )
+        {
+            pos = 0.5 * maxAcceleration * time * time;
+            vel = maxAcceleration * time;
+        }
+        else if ( time < accelTime + cruiseTime )
+        {
+            pos = accelDist + peakVel * (time - accelTime);
+            vel = peakVel;
+        }
+        else
+        {
+            auto timeLeft = totalTime - time;
+            pos = distance - 0.5 * maxAcceleration * timeLeft * timeLeft;
+            vel = maxAcceleration * timeLeft;
+        }
+        points.emplace_back(MotionProfilePoint{start + direction * pos, direction * vel, periodMs});
+
+        if ( time >= totalTime )
+        {
+            break;
+        }
+    }
+    return points;
+}
+
+bool DragonMotionProfile::Start
+(
+    double          start,
+    double          target,
+    ControlData*    controlData
+)
+{
+    m_underruns = 0;
+    m_totalPoints = 0;
+    m_progress = {false, false, false, 0};
+
+    if ( m_motor.get() == nullptr || controlData == nullptr )
+    {
+        return false;
+    }
+
+    auto points = Generate(start, target, controlData->GetCruiseVelocity(), controlData->GetMaxAcceleration(), m_periodMs);
+    if ( points.empty() )
+    {
+        Logger::GetLogger()->LogError( string("DragonMotionProfile::Start"), string("invalid cruise velocity or max acceleration"));
+        return false;
+    }
+
+    m_progress.active = m_motor.get()->StartMotionProfile(points);
+    m_totalPoints = static_cast<int>(points.size());
+    m_progress.pointsRemaining = m_totalPoints;
+    Logger::GetLogger()->ToNtTable(m_ntName, string("profile points"), m_totalPoints);
+    return m_progress.active;
+}
+
+void DragonMotionProfile::Update()
+{
+    if ( m_motor.get() == nullptr || !m_progress.active )
+    {
+        return;
+    }
+
+    m_progress = m_motor.get()->GetMotionProfileProgress();
+    if ( m_progress.hasUnderrun )
+    {
+        ++m_underruns;
+    }
+
+    Logger::GetLogger()->ToNtTable(m_ntName, string("profile complete"), GetPercentComplete());
+    Logger::GetLogger()->ToNtTable(m_ntName, string("profile underruns"), m_underruns);
+}
+
+void DragonMotionProfile::Stop()
+{
+    if ( m_motor.get() != nullptr && m_progress.active )
+    {
+        m_motor.get()->StopMotionProfile();
+    }
+    m_progress.active = false;
+}
+
+double DragonMotionProfile::GetPercentComplete() const
+{
+    if ( m_totalPoints <= 0 || m_progress.finished )
+    {
+        return 1.0;
+    }
+    auto done = m_totalPoints - m_progress.pointsRemaining;
+    return clamp(static_cast<double>(done) / m_totalPoints, 0.0, 1.0);
+}
@@ -0,0 +1,93 @@
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302 
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+#pragma once
+
+// C++ Includes
+#include <memory>
+#include <string>
+#include <vector>
+
+// Team 302 includes
+#include <controllers/MotionProfilePoint.h>
+
+class ControlData;
+class IDragonMotorController;
+
+/// @class  DragonMotionProfile
+/// @brief  Pre-computes a trapezoidal, time-parameterized profile for a mechanism move and streams
+///         it into the motor controller's buffered trajectory.  The controller runs the points at its
+///         own rate, so the move doesn't depend on the RIO loop timing.  Progress and underruns are
+///         reported to the network table on each Update.
+class DragonMotionProfile
+{
+    public:
+        DragonMotionProfile
+        (
+            std::shared_ptr<IDragonMotorController>     motor,
+            std::string                                 ntName
+        );
+        DragonMotionProfile() = delete;
+        ~DragonMotionProfile() = default;
+
+        /// @brief  Build the trapezoidal profile between two positions
+        /// @param [in] double start - starting position (inches or degrees)
+        /// @param [in] double target - ending position (inches or degrees)
+        /// @param [in] double cruiseVelocity - maximum speed (units per second)
+        /// @param [in] double maxAcceleration - maximum acceleration (units per second squared)
+        /// @param [in] int    periodMs - time between points
+        /// @return std::vector<MotionProfilePoint> - the points; empty if the constraints are invalid
+        static std::vector<MotionProfilePoint> Generate
+        (
+            double      start,
+            double      target,
+            double      cruiseVelocity,
+            double      maxAcceleration,
+            int         periodMs
+        );
+
+        /// @brief  Generate the profile using the control data's cruise velocity and max acceleration
+        ///         and start streaming it to the motor controller
+        /// @return bool - true if the profile was started
+        bool Start
+        (
+            double          start,
+            double          target,
+            ControlData*    controlData
+        );
+
+        /// @brief  Query the controller and log progress and underruns
+        void Update();
+
+        /// @brief  Stop the profile (the controller is left holding its last output)
+        void Stop();
+
+        bool IsActive() const { return m_progress.active; }
+        bool IsDone() const { return !m_progress.active || m_progress.finished; }
+        int  GetUnderrunCount() const { return m_underruns; }
+
+        /// @brief  Fraction of the profile that has been executed
+        /// @return double - 0.0 to 1.0
+        double GetPercentComplete() const;
+
+    private:
+        static constexpr int                    m_periodMs = 10;
+
+        std::shared_ptr<IDragonMotorController> m_motor;
+        std::string                             m_ntName;
+        MotionProfileProgress                   m_progress;
+        int                                     m_totalPoints;
+        int                                     m_underruns;
+};
@@ -41,6 +41,7 @@ MechanismTargetData::MechanismTargetData
     m_controlData2(nullptr),
     m_solenoid( solenoid ),
     m_secondTarget( secondTarget ),
+    m_robotPitch( robotPitch ),
     m_function1Coeff(function1Coeff),
     m_function2Coeff(function2Coeff)
 {
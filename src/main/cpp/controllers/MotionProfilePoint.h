@@ -0,0 +1,37 @@
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302 
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+#pragma once
+
+/// @struct MotionProfilePoint
+/// @brief  One time-parameterized point of a buffered motion profile.  Position and velocity are in
+///         mechanism units (inches or degrees and inches or degrees per second); the motor controller
+///         converts them to sensor units when the point is streamed.
+struct MotionProfilePoint
+{
+    double      position;
+    double      velocity;
+    int         durationMs;
+};
+
+/// @struct MotionProfileProgress
+/// @brief  Status of the buffered motion profile running on a motor controller
+struct MotionProfileProgress
+{
+    bool        active;             /// a profile has been started and not stopped
+    bool        finished;           /// the last point has been executed
+    bool        hasUnderrun;        /// the controller ran out of points since the last check
+    int         pointsRemaining;    /// points still buffered (RIO side and controller side)
+};
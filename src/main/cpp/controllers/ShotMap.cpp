@@ -0,0 +1,90 @@
+
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302 
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF 
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, 
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE 
+// OR OTHER DEALINGS IN THE SOFTWARE.
+
+// C++ Includes
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+// FRC includes
+
+// Team 302 includes
+#include <controllers/ShotMap.h>
+
+// Third Party Includes
+
+using namespace std;
+
+void ShotMap::SetPoints
+(
+    const vector<Point>&    points
+)
+{
+    m_points.clear();
+    m_points.reserve(points.size());
+    for ( auto& point : points )
+    {
+        AddPoint(point);
+    }
+}
+
+void ShotMap::AddPoint
+(
+    const Point&            point
+)
+{
+    auto itr = lower_bound(m_points.begin(), m_points.end(), point.distance - SAME_DISTANCE, 
+                           [](const Point& p, double value) { return p.distance <= value; });
+    if ( itr != m_points.end() && abs(itr->distance - point.distance) < SAME_DISTANCE )
+    {
+        *itr = point;
+    }
+    else
+    {
+        itr = lower_bound(m_points.begin(), m_points.end(), point.distance, 
+                          [](const Point& p, double value) { return p.distance < value; });
+        m_points.insert(itr, point);
+    }
+}
+
+ShotMap::Point ShotMap::Lookup
+(
+    double                  distance
+) const
+{
+    if ( m_points.empty() )
+    {
+        return {distance, 0.0, 0.0, 0.0};
+    }
+
+    // first point farther than the distance
+    auto upper = upper_bound(m_points.begin(), m_points.end(), distance, 
+                             [](double value, const Point& p) { return value < p.distance; });
+    if ( upper == m_points.begin() )
+    {
+        return {distance, upper->top, upper->bottom, upper->hood};
+    }
+    auto lower = upper - 1;
+    if ( upper == m_points.end() )
+    {
+        return {distance, lower->top, lower->bottom, lower->hood};
+    }
+
+    auto fraction = (distance - lower->distance) / (upper->distance - lower->distance);
+    return {distance, 
+            lower->top + fraction * (upper->top - lower->top),
+            lower->bottom + fraction * (upper->bottom - lower->bottom),
+            lower->hood + fraction * (upper->hood - lower->hood)};
+}
@@ -0,0 +1,81 @@
+
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302 
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF 
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, 
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE 
+// OR OTHER DEALINGS IN THE SOFTWARE.
+
+#pragma once
+
+// C++ Includes
+#include <cstddef>
+#include <vector>
+
+// FRC includes
+
+// Team 302 includes
+
+// Third Party Includes
+
+
+/// @class ShotMap
+/// @brief Calibrated shots by distance to the goal.  The points are kept sorted by distance, so a 
+///        lookup is a binary search and a linear interpolation between the two neighboring points
+///        (clamped to the first and last points).  That is cheap enough to re-target the shooter 
+///        every loop.  The points come from the shooter state file and more can be added while 
+///        practicing.
+class ShotMap
+{
+    public:
+        /// @brief  one calibrated shot
+        struct Point
+        {
+            double  distance;   // inches from the limelight to the goal
+            double  top;        // primary (top) wheel target
+            double  bottom;     // secondary (bottom) wheel target
+            double  hood;       // hood target
+        };
+
+        /// @brief  Points closer than this (inches) are the same point
+        static constexpr double SAME_DISTANCE = 1.0;
+
+        ShotMap() = default;
+        ~ShotMap() = default;
+
+        /// @brief  Replace the points
+        /// @param [in] const std::vector<Point>& points - points in any order
+        void SetPoints
+        (
+            const std::vector<Point>&   points
+        );
+
+        /// @brief  Add a point, replacing a point at the same distance
+        /// @param [in] const Point& point - point to add
+        void AddPoint
+        (
+            const Point&                point
+        );
+
+        /// @brief  Interpolate the shot for a distance
+        /// @param [in] double distance - inches to the goal
+        /// @return Point - the shot (all zero if there are no points)
+        Point Lookup
+        (
+            double                      distance
+        ) const;
+
+        inline bool IsEmpty() const { return m_points.empty(); }
+        inline size_t Size() const { return m_points.size(); }
+        inline const std::vector<Point>& GetPoints() const { return m_points; }
+
+    private:
+        std::vector<Point>      m_points;   // sorted by distance
+};
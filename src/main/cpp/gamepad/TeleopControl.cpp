@@ -58,6 +58,9 @@ TeleopControl::TeleopControl() : m_axisIDs(),
 								 m_buttonIDs(),
 								 m_controllerIndex(),
 								 m_controllers(),
+								 m_mappedButtons(),
+								 m_mappedAxes(),
+								 m_frame(),
 								 m_count( 0 )
 {
 	for ( int inx=0; inx<DriverStation::kJoystickPorts; ++inx )
@@ -91,7 +94,8 @@ TeleopControl::TeleopControl() : m_axisIDs(),
 	L-Stick Robot Drive (Field Orient) 				SWERVE_DRIVE_DRIVE  << SWERVEDIRVE.CPP  <<ROBOT.CPP
 	R-Stick X Axis Robot Rotation 					SWERVE_DRIVE_ROTATE  << SWERVEDIRVE.CPP  <<ROBOT.CPP
 	Left Bumper - 	Maintain Target					FINDTARGET  << SWERVEDIRVE.CPP
-	Right Bumper - Polar Drive        				DRIVE_POLAR  << SWERVEDIRVE.CPP
+	Right Bumper - Climber Initial Reach			CLIMBER_STATE_INITIAL_REACH  <<ClimberStateMgr
+	Down d-Pad - Drive to Shooting Spot				DRIVE_TO_SHOOTING_SPOT  << SWERVEDIRVE.CPP
 
 	Right Trigger - Climber Manual UP   			CLIMBER_MAN_UP <<ClimberStateMgr
 	Left Trigger Climber manual DOWN    			CLIMBER_MAN_DOWN  <<ClimberStateMgr
@@ -112,8 +116,8 @@ TeleopControl::TeleopControl() : m_axisIDs(),
 		m_controllerIndex[ SWERVE_DRIVE_ROTATE]			= ctrlNo;
 		m_axisIDs[ SWERVE_DRIVE_ROTATE]					= IDragonGamePad::RIGHT_JOYSTICK_X;
 	
-		//m_controllerIndex[ DRIVE_TO_SHOOTING_SPOT ]		= ctrlNo;
-		//m_buttonIDs[ DRIVE_TO_SHOOTING_SPOT ]			= IDragonGamePad::A_BUTTON;
+		m_controllerIndex[ DRIVE_TO_SHOOTING_SPOT ]		= ctrlNo;
+		m_buttonIDs[ DRIVE_TO_SHOOTING_SPOT ]			= IDragonGamePad::POV_180;
 		m_controllerIndex[ REZERO_PIGEON ]				= ctrlNo;
 		m_buttonIDs[ REZERO_PIGEON ]					= IDragonGamePad::B_BUTTON;
 		//m_controllerIndex[DRIVE_POLAR] 					= ctrlNo;  
@@ -329,6 +333,51 @@ TeleopControl::TeleopControl() : m_axisIDs(),
 	{
         Logger::GetLogger()->LogError( string("TeleopControl::TeleopControl"), string("Controller 5 not handled"));
     }
+
+	// only the mapped functions are read each loop
+	for ( int inx=0; inx<FUNCTION_IDENTIFIER::MAX_FUNCTIONS; ++inx )
+	{
+		auto ctlIndex = m_controllerIndex[inx];
+		if ( ctlIndex > -1 && m_controllers[ ctlIndex ] != nullptr )
+		{
+			if ( m_buttonIDs[inx] != IDragonGamePad::BUTTON_IDENTIFIER::UNDEFINED_BUTTON )
+			{
+				m_mappedButtons.emplace_back( static_cast<FUNCTION_IDENTIFIER>(inx) );
+			}
+			if ( m_axisIDs[inx] != IDragonGamePad::AXIS_IDENTIFIER::UNDEFINED_AXIS )
+			{
+				m_mappedAxes.emplace_back( static_cast<FUNCTION_IDENTIFIER>(inx) );
+			}
+		}
+	}
+	Update();
+}
+
+//------------------------------------------------------------------
+// Method:      Update
+// Description: Read the controllers into the input frame.  Call once
+//              at the start of each loop, before anything reads
+//              the buttons or axes.
+// Returns:     void
+//------------------------------------------------------------------
+void TeleopControl::Update()
+{
+	auto previous = m_frame.pressed;
+	m_frame.pressed.reset();
+	for ( auto function : m_mappedButtons )
+	{
+		if ( m_controllers[ m_controllerIndex[function] ]->IsButtonPressed( m_buttonIDs[function] ) )
+		{
+			m_frame.pressed.set( function );
+		}
+	}
+	m_frame.wasPressed  = m_frame.pressed & ~previous;
+	m_frame.wasReleased = previous & ~m_frame.pressed;
+
+	for ( auto function : m_mappedAxes )
+	{
+		m_frame.axes[function] = m_controllers[ m_controllerIndex[function] ]->GetAxisValue( m_axisIDs[function] );
+	}
 }
 
 
@@ -397,53 +446,3 @@ void TeleopControl::SetAxisProfile
     	}
     }
 }
- 
-//------------------------------------------------------------------
-// Method:      GetAxisValue
-// Description: Reads the joystick axis, removes any deadband (small
-//              value) and then scales as requested.
-// Returns:     double   -  scaled axis value
-//------------------------------------------------------------------
-double TeleopControl::GetAxisValue
-(
-    TeleopControl::FUNCTION_IDENTIFIER  function    // <I> - function that whose axis will be read
-) const
-{
-    double value = 0.0;
-	int ctlIndex = m_controllerIndex[ function];
-	IDragonGamePad::AXIS_IDENTIFIER axis = m_axisIDs[ function ];
-    if ( ctlIndex > -1 && axis != IDragonGamePad::AXIS_IDENTIFIER::UNDEFINED_AXIS  )
-    {
-    	if (m_controllers[ ctlIndex ] != nullptr)
-    	{
-    		value = m_controllers[ ctlIndex ]->GetAxisValue( axis );
-    	}
-    }
-    return value;
-}
-
-//------------------------------------------------------------------
-// Method:      IsButtonPressed
-// Description: Reads the button value.  Also allows POV, bumpers,
-//              and triggers to be treated as buttons.
-// Returns:     bool   -  scaled axis value
-//------------------------------------------------------------------
-bool TeleopControl::IsButtonPressed
-(
-    TeleopControl::FUNCTION_IDENTIFIER  function    // <I> - function that whose button will be read
-) const
-{
-    bool isSelected = false;
-	int ctlIndex = m_controllerIndex[ function];
-	IDragonGamePad::BUTTON_IDENTIFIER btn = m_buttonIDs[ function ];
-    if ( ctlIndex > -1 && btn != IDragonGamePad::BUTTON_IDENTIFIER::UNDEFINED_BUTTON  )
-    {
-    	if (m_controllers[ ctlIndex ] != nullptr)
-    	{
-    		isSelected = m_controllers[ ctlIndex ]->IsButtonPressed( btn );
-    	}
-    }
-    return isSelected;
-}
-
-
@@ -17,8 +17,11 @@
 #pragma once 
 
 // C++ Includes
+#include <array>
+#include <bitset>
 #include <memory>
 #include <map>
+#include <vector>
 
 
 // FRC includes
@@ -101,6 +104,17 @@ class TeleopControl
             MAX_FUNCTIONS
         };
 
+        /// @brief  The controller inputs for one loop.  Update reads every mapped button and axis once,
+        ///         so the state managers and the drive all see the same inputs and reading one is an
+        ///         array lookup.
+        struct InputFrame
+        {
+            std::bitset<MAX_FUNCTIONS>          pressed;        // button is down
+            std::bitset<MAX_FUNCTIONS>          wasPressed;     // button went down this loop
+            std::bitset<MAX_FUNCTIONS>          wasReleased;    // button went up this loop
+            std::array<double, MAX_FUNCTIONS>   axes;           // axis values with the deadband, profile and scale applied
+        };
+
 
         //----------------------------------------------------------------------------------
         // Method:      GetInstance
@@ -110,6 +124,22 @@ class TeleopControl
         //----------------------------------------------------------------------------------
         static TeleopControl* GetInstance();
 
+        //------------------------------------------------------------------
+        // Method:      Update
+        // Description: Read the controllers into the input frame.  Call once
+        //              at the start of each loop, before anything reads
+        //              the buttons or axes.
+        // Returns:     void
+        //------------------------------------------------------------------
+        void Update();
+
+        //------------------------------------------------------------------
+        // Method:      GetInputFrame
+        // Description: Inputs read by the last Update
+        // Returns:     const InputFrame&
+        //------------------------------------------------------------------
+        inline const InputFrame& GetInputFrame() const { return m_frame; }
+
 
         //------------------------------------------------------------------
         // Method:      SetScaleFactor
@@ -146,25 +176,40 @@ class TeleopControl
 
         //------------------------------------------------------------------
         // Method:      GetAxisValue
-        // Description: Reads the joystick axis, removes any deadband (small
-        //              value) and then scales as requested.
+        // Description: The joystick axis from the input frame with any 
+        //              deadband (small value) removed and scaled as requested.
         // Returns:     double   -  scaled axis value
         //------------------------------------------------------------------
-        double GetAxisValue
+        inline double GetAxisValue
         (
             TeleopControl::FUNCTION_IDENTIFIER     axis // <I> - axis number to update
-        ) const;
+        ) const { return m_frame.axes[axis]; }
 
         //------------------------------------------------------------------
-        // Method:      GetRawButton
-        // Description: Reads the button value.  Also allows POV, bumpers,
-        //              and triggers to be treated as buttons.
-        // Returns:     bool   -  scaled axis value
+        // Method:      IsButtonPressed
+        // Description: The button value from the input frame.  Also allows 
+        //              POV, bumpers, and triggers to be treated as buttons.
+        // Returns:     bool   -  true if the button is down
         //------------------------------------------------------------------
-        bool IsButtonPressed
+        inline bool IsButtonPressed
         (
             TeleopControl::FUNCTION_IDENTIFIER button   // <I> - button number to query
-        ) const;
+        ) const { return m_frame.pressed[button]; }
+
+        //------------------------------------------------------------------
+        // Method:      WasButtonPressed / WasButtonReleased
+        // Description: Did the button go down (up) since the last loop
+        // Returns:     bool
+        //------------------------------------------------------------------
+        inline bool WasButtonPressed
+        (
+            TeleopControl::FUNCTION_IDENTIFIER button   // <I> - button number to query
+        ) const { return m_frame.wasPressed[button]; }
+
+        inline bool WasButtonReleased
+        (
+            TeleopControl::FUNCTION_IDENTIFIER button   // <I> - button number to query
+        ) const { return m_frame.wasReleased[button]; }
 
 
     private:
@@ -195,6 +240,10 @@ class TeleopControl
 
         IDragonGamePad*			            m_controllers[frc::DriverStation::kJoystickPorts];
 
+        std::vector<FUNCTION_IDENTIFIER>    m_mappedButtons;    // functions with a button (read by Update)
+        std::vector<FUNCTION_IDENTIFIER>    m_mappedAxes;       // functions with an axis (read by Update)
+        InputFrame                          m_frame;
+
         mutable int                         m_count;
 };
 
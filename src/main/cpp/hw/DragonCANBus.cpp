@@ -0,0 +1,157 @@
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302 
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+// C++ Includes
+#include <string>
+
+// FRC includes
+
+// Team 302 includes
+#include <hw/DragonCANBus.h>
+#include <utils/Logger.h>
+
+// Third Party Includes
+
+using namespace std;
+
+DragonCANBus* DragonCANBus::m_instance = nullptr;
+
+DragonCANBus* DragonCANBus::GetInstance()
+{
+    if ( DragonCANBus::m_instance == nullptr )
+    {
+        DragonCANBus::m_instance = new DragonCANBus();
+    }
+    return DragonCANBus::m_instance;
+}
+
+DragonCANBus::DragonCANBus() : m_buses()
+{
+}
+
+string DragonCANBus::GetBusName
+(
+    const string&   busName,
+    const string&   defaultBus
+)
+{
+    auto name = busName.empty() ? defaultBus : busName;
+    return name.empty() ? string(RIO_BUS) : name;
+}
+
+void DragonCANBus::AddDevice
+(
+    const string&       busName,
+    int                 canID,
+    CAN_DEVICE_TYPE     type,
+    const string&       identifier
+)
+{
+    auto name = GetBusName(busName, string(RIO_BUS));
+    auto& bus = m_buses[name];
+    if ( canID > -1 && canID < 63 && type >= TALON_SRX && type < MAX_CAN_DEVICE_TYPES )
+    {
+        auto& canIDs = bus.canIDs[GetDeviceClass(type)];
+        if ( canIDs.test(canID) )
+        {
+            string msg = identifier;
+            msg += string(" duplicates CAN ID ");
+            msg += to_string(canID);
+            msg += string(" on bus ");
+            msg += name;
+            Logger::GetLogger()->LogError(string("DragonCANBus::AddDevice"), msg);
+        }
+        canIDs.set(canID);
+    }
+
+    bus.devices++;
+    if ( type >= TALON_SRX && type < MAX_CAN_DEVICE_TYPES )
+    {
+        bus.statusFramesPerSec  += m_framesPerSec[type][0];
+        bus.controlFramesPerSec += m_framesPerSec[type][1];
+    }
+}
+
+bool DragonCANBus::CheckLoad() const
+{
+    auto ok = true;
+    for ( auto& [name, bus] : m_buses )
+    {
+        auto load = GetLoad(bus);
+        auto ntName = string("CANBus ") + name;
+        Logger::GetLogger()->ToNtTable(ntName, string("devices"), static_cast<double>(bus.devices));
+        Logger::GetLogger()->ToNtTable(ntName, string("status frames per sec"), bus.statusFramesPerSec);
+        Logger::GetLogger()->ToNtTable(ntName, string("control frames per sec"), bus.controlFramesPerSec);
+        Logger::GetLogger()->ToNtTable(ntName, string("estimated load"), load * 100.0);
+
+        if ( load > MAX_LOAD )
+        {
+            string msg = string("bus ") + name;
+            msg += string(" estimated load ");
+            msg += to_string(static_cast<int>(load * 100.0));
+            msg += string("% with ");
+            msg += to_string(bus.devices);
+            msg += string(" devices; move devices to another bus or slow their status frames");
+            Logger::GetLogger()->LogError(Logger::LOGGER_LEVEL::WARNING, string("DragonCANBus::CheckLoad"), msg);
+            ok = false;
+        }
+    }
+    return ok;
+}
+
+double DragonCANBus::GetEstimatedLoad
+(
+    const string&   busName
+) const
+{
+    auto itr = m_buses.find(GetBusName(busName, string(RIO_BUS)));
+    return itr != m_buses.end() ? GetLoad(itr->second) : 0.0;
+}
+
+int DragonCANBus::GetDeviceCount
+(
+    const string&   busName
+) const
+{
+    auto itr = m_buses.find(GetBusName(busName, string(RIO_BUS)));
+    return itr != m_buses.end() ? itr->second.devices : 0;
+}
+
+DragonCANBus::CAN_DEVICE_CLASS DragonCANBus::GetDeviceClass
+(
+    CAN_DEVICE_TYPE     type
+)
+{
+    switch ( type )
+    {
+        case CANCODER:
+            return CANCODER_CLASS;
+
+        case PIGEON:
+        case PIGEON2:
+            return PIGEON_CLASS;
+
+        default:
+            return MOTOR_CONTROLLER;
+    }
+}
+
+double DragonCANBus::GetLoad
+(
+    const BusData&  bus
+)
+{
+    return (bus.statusFramesPerSec + bus.controlFramesPerSec) * m_bitsPerFrame / m_bitsPerSecond;
+}
@@ -0,0 +1,159 @@
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302 
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+#pragma once
+
+// C++ Includes
+#include <array>
+#include <bitset>
+#include <map>
+#include <string>
+
+// FRC includes
+
+// Team 302 includes
+
+// Third Party Includes
+
+
+/// @class DragonCANBus
+/// @brief Keeps track of which CAN bus (the roboRIO bus or a CANivore) each device is on, so the
+///        robot.xml topology can be checked at startup.  For each bus it counts the devices and
+///        estimates the status and control frame load from the CTRE default frame periods.  Buses
+///        that are estimated to be oversubscribed are reported as warnings.
+class DragonCANBus
+{
+    public:
+        /// @enum  CAN_DEVICE_TYPE
+        /// @brief types of devices that are accounted for
+        enum CAN_DEVICE_TYPE
+        {
+            TALON_SRX,
+            TALON_FX,
+            CANCODER,
+            PIGEON,
+            PIGEON2,
+            MAX_CAN_DEVICE_TYPES
+        };
+
+        /// @brief bus name for the roboRIO's built-in CAN bus
+        static constexpr const char* RIO_BUS = "rio";
+
+        /// @brief bus name used for the swerve CANivore
+        static constexpr const char* CANIVORE_BUS = "canivore";
+
+        /// @brief estimated bus utilization (0.0 to 1.0) that triggers the oversubscribed warning
+        static constexpr double MAX_LOAD = 0.7;
+
+        /// @brief  Find or create the singleton
+        /// @return DragonCANBus* - the bus accounting object
+        static DragonCANBus* GetInstance();
+
+        /// @brief  Map an XML bus name to the name used by the CTRE library ("" and "rio" are the roboRIO bus)
+        /// @param [in] const std::string& busName - name from the XML (may be empty)
+        /// @param [in] const std::string& defaultBus - bus to use if no name was given
+        /// @return std::string - bus name
+        static std::string GetBusName
+        (
+            const std::string&      busName,
+            const std::string&      defaultBus
+        );
+
+        /// @brief  Record a device on a bus.  A duplicate CAN ID on the same bus is logged as an error
+        ///         when both devices are the same class (CTRE allows e.g. a Falcon and a CANcoder to 
+        ///         share an ID).
+        /// @param [in] const std::string& busName - bus the device is on
+        /// @param [in] int canID - CAN ID of the device
+        /// @param [in] CAN_DEVICE_TYPE type - type of device (used for the frame rate estimate)
+        /// @param [in] const std::string& identifier - usage or name of the device for messages
+        void AddDevice
+        (
+            const std::string&      busName,
+            int                     canID,
+            CAN_DEVICE_TYPE         type,
+            const std::string&      identifier
+        );
+
+        /// @brief  Publish the per-bus counts and load estimates to the network table and warn about
+        ///         any bus that is oversubscribed
+        /// @return bool - true if all of the buses are within the load limit
+        bool CheckLoad() const;
+
+        /// @brief  Estimated utilization of a bus
+        /// @param [in] const std::string& busName - bus to look up
+        /// @return double - 0.0 to 1.0 (or above if oversubscribed); 0.0 if there are no devices on the bus
+        double GetEstimatedLoad
+        (
+            const std::string&      busName
+        ) const;
+
+        /// @brief  Number of devices on a bus
+        int GetDeviceCount
+        (
+            const std::string&      busName
+        ) const;
+
+    private:
+        DragonCANBus();
+        ~DragonCANBus() = default;
+
+        /// @brief  device classes that have their own CAN ID space
+        enum CAN_DEVICE_CLASS
+        {
+            MOTOR_CONTROLLER,   // Talon SRX and Talon FX
+            CANCODER_CLASS,
+            PIGEON_CLASS,       // Pigeon IMU and Pigeon 2
+            MAX_CAN_DEVICE_CLASSES
+        };
+
+        struct BusData
+        {
+            int                                                 devices = 0;
+            double                                              statusFramesPerSec = 0.0;
+            double                                              controlFramesPerSec = 0.0;
+            std::array<std::bitset<63>, MAX_CAN_DEVICE_CLASSES> canIDs;
+        };
+
+        /// @brief  ID space the device type is in
+        static CAN_DEVICE_CLASS GetDeviceClass
+        (
+            CAN_DEVICE_TYPE     type
+        );
+
+        /// @brief  Estimated utilization from the frame rates
+        static double GetLoad
+        (
+            const BusData&      bus
+        );
+
+        // CAN 2.0B at 1 Mbit/s (CANivore devices in Phoenix 5 still use CAN 2.0 frames); an extended
+        // frame with 8 data bytes is ~130 bits before stuffing, so use a conservative average
+        static constexpr double             m_bitsPerSecond = 1000000.0;
+        static constexpr double             m_bitsPerFrame = 150.0;
+
+        // frames per second with the CTRE default frame periods           status  control
+        static constexpr double             m_framesPerSec[MAX_CAN_DEVICE_TYPES][2] =
+        {
+            { 185.0, 100.0 },   // TALON_SRX:  status 1 @ 10ms, status 2 @ 20ms, others @ 160ms; control @ 10ms
+            { 190.0, 100.0 },   // TALON_FX:   status 1 @ 10ms, status 2 @ 20ms, others @ 160-250ms; control @ 10ms
+            { 110.0, 0.0 },     // CANCODER:   sensor data @ 10ms, battery @ 100ms
+            { 60.0, 0.0 },      // PIGEON:     with the mag, gyro accum and accel frames slowed to 120ms
+            { 110.0, 0.0 }      // PIGEON2:    yaw/pitch/roll @ 10ms, others @ 100ms
+        };
+
+        std::map<std::string, BusData>      m_buses;
+
+        static DragonCANBus*                m_instance;
+};
@@ -36,6 +36,7 @@
 // Third Party Includes
 #include <ctre/phoenix/motorcontrol/RemoteSensorSource.h>
 #include <ctre/phoenix/ErrorCode.h>
+#include <ctre/phoenix/motion/BufferedTrajectoryPointStream.h>
 #include <ctre/phoenix/motorcontrol/can/WPI_TalonFX.h>
 
 
@@ -48,6 +49,7 @@ class DragonFalcon : public IDragonMotorController
         (
             MotorControllerUsage::MOTOR_CONTROLLER_USAGE deviceType, 
             int deviceID, 
+            const std::string& canBusName,
             int pdpID, 
             int countsPerRev, 
             double gearRatio,
@@ -65,6 +67,7 @@ class DragonFalcon : public IDragonMotorController
         int GetID() const override;
         std::shared_ptr<frc::MotorController> GetSpeedController() const override;
         double GetCurrent() const override;
+        double GetMotorOutputPercent() const override;
         IDragonMotorController::MOTOR_TYPE GetMotorType() const override;
 
         // Setters (override)
@@ -155,6 +158,28 @@ class DragonFalcon : public IDragonMotorController
         (
             bool enable
         ) override;
+        void SetSoftLimits
+        (
+            bool    enableForward,
+            double  forwardLimit,
+            bool    enableReverse,
+            double  reverseLimit
+        ) override;
+        void SetClearPositionOnLimitSwitch
+        (
+            bool    forward,
+            bool    reverse
+        ) override;
+        bool IsForwardLimitEnforced() const override { return m_forwardLimitSwitch || m_forwardSoftLimit; }
+        bool IsReverseLimitEnforced() const override { return m_reverseLimitSwitch || m_reverseSoftLimit; }
+        double GetForwardSoftLimit() const override { return m_forwardSoftLimitPosition; }
+        double GetReverseSoftLimit() const override { return m_reverseSoftLimitPosition; }
+        bool StartMotionProfile
+        (
+            const std::vector<MotionProfilePoint>&  points
+        ) override;
+        MotionProfileProgress GetMotionProfileProgress() override;
+        void StopMotionProfile() override;
     private:
         std::shared_ptr<ctre::phoenix::motorcontrol::can::WPI_TalonFX>  m_talon;
         ControlModes::CONTROL_TYPE m_controlMode;
@@ -169,5 +194,15 @@ class DragonFalcon : public IDragonMotorController
         double m_countsPerInch;
         double m_countsPerDegree;
         IDragonMotorController::MOTOR_TYPE m_motorType;
+        bool m_forwardLimitSwitch;
+        bool m_reverseLimitSwitch;
+        bool m_forwardSoftLimit;
+        bool m_reverseSoftLimit;
+        double m_forwardSoftLimitPosition;
+        double m_reverseSoftLimitPosition;
+        bool m_profileActive;
+        ctre::phoenix::motion::BufferedTrajectoryPointStream m_profileStream;
+
+        double PositionToCounts( double position ) const;
 };
 
@@ -15,7 +15,9 @@
 //====================================================================================================================================================
 
 #include <ctre/phoenix/Sensors/PigeonIMU.h>
+#include <hw/DragonCANBus.h>
 #include <hw/DragonPigeon.h>
+#include <utils/Logger.h>
 #include <memory>
 
 using namespace std;
@@ -25,6 +27,7 @@ using namespace ctre::phoenix::sensors;
 DragonPigeon::DragonPigeon
 (
     int    canID,
+    const string& canBusName,
     DragonPigeon::PIGEON_USAGE usage,
     DragonPigeon::PIGEON_TYPE type,
     double rotation
@@ -34,8 +37,16 @@ DragonPigeon::DragonPigeon
     m_initialPitch(0.0),
     m_initialRoll(0.0)
 {
+    auto bus = DragonCANBus::GetBusName(canBusName, string(DragonCANBus::RIO_BUS));
     if (type == DragonPigeon::PIGEON_TYPE::PIGEON1)
     {
+        // the original pigeon is only supported on the roboRIO bus
+        if (bus != string(DragonCANBus::RIO_BUS))
+        {
+            Logger::GetLogger()->LogError(string("DragonPigeon::DragonPigeon"), string("pigeon1 can't be on bus ") + bus);
+        }
+        DragonCANBus::GetInstance()->AddDevice(string(DragonCANBus::RIO_BUS), canID, DragonCANBus::CAN_DEVICE_TYPE::PIGEON, string("pigeon"));
+
         m_pigeon = new WPI_PigeonIMU(canID);
         m_pigeon->ConfigFactoryDefault();
         m_pigeon->SetYaw(rotation, 0);
@@ -47,7 +58,9 @@ DragonPigeon::DragonPigeon
     }
     else
     {
-        m_pigeon2 = new WPI_Pigeon2(canID);
+        DragonCANBus::GetInstance()->AddDevice(bus, canID, DragonCANBus::CAN_DEVICE_TYPE::PIGEON2, string("pigeon2"));
+
+        m_pigeon2 = new WPI_Pigeon2(canID, bus);
         m_pigeon2->ConfigFactoryDefault();
         m_pigeon2->SetYaw(rotation);
 
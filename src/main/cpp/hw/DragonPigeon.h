@@ -16,6 +16,7 @@
 
 #pragma once
 #include <memory>
+#include <string>
 #include <ctre/phoenix/sensors/WPI_PigeonIMU.h>
 #include <ctre/phoenix/sensors/WPI_Pigeon2.h>
 #include <ctre/Phoenix.h>
@@ -39,6 +40,7 @@ class DragonPigeon
         DragonPigeon
         (
             int  canID,
+            const std::string& canBusName,
             DragonPigeon::PIGEON_USAGE usage,
             DragonPigeon::PIGEON_TYPE type,
             double rotation
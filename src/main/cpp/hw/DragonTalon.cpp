@@ -15,6 +15,7 @@
 //====================================================================================================================================================
 
 // C++ Includes
+#include <limits>
 #include <memory>
 #include <string>
 
@@ -68,7 +69,15 @@ DragonTalon::DragonTalon
 	m_diameter( 1.0 ),
 	m_countsPerInch(countsPerInch),
 	m_countsPerDegree(countsPerDegree),
-	m_motorType(motorType)
+	m_motorType(motorType),
+	m_forwardLimitSwitch(false),
+	m_reverseLimitSwitch(false),
+	m_forwardSoftLimit(false),
+	m_reverseSoftLimit(false),
+	m_forwardSoftLimitPosition(numeric_limits<double>::max()),
+	m_reverseSoftLimitPosition(numeric_limits<double>::lowest()),
+	m_profileActive(false),
+	m_profileStream()
 {
 	// for all calls if we get an error log it; for key items try again
 	auto prompt = string("Dragon Talon");
@@ -302,6 +311,10 @@ double DragonTalon::GetRPS() const
 void DragonTalon::SetControlMode(ControlModes::CONTROL_TYPE mode)
 { 
 	m_controlMode = mode;
+	if ( mode != ControlModes::CONTROL_TYPE::MOTION_PROFILE && mode != ControlModes::CONTROL_TYPE::MOTION_PROFILE_ARC )
+	{
+		m_profileActive = false;
+	}
 }
 
 shared_ptr<MotorController> DragonTalon::GetSpeedController() const
@@ -327,6 +340,11 @@ double DragonTalon::GetCurrent() const
 	return 0.0;
 }
 
+double DragonTalon::GetMotorOutputPercent() const
+{
+	return m_talon.get()->GetMotorOutputPercent();
+}
+
 void DragonTalon::UpdateFramePeriods
 (
 	ctre::phoenix::motorcontrol::StatusFrameEnhanced	frame,
@@ -402,6 +420,11 @@ void DragonTalon::Set(std::shared_ptr<nt::NetworkTable> nt, double value)
 		Logger::GetLogger()->ToNtTable(nt, string("motor target output voltage"), value);
 		m_talon.get()->SetVoltage(units::voltage::volt_t(value));
 	}
+	else if ( m_profileActive )
+	{
+		// the buffered motion profile is running on the controller, so there is nothing to send
+		Logger::GetLogger()->ToNtTable(nt, string("motor target output"), value);
+	}
 	else
 	{
 		auto output = value;
@@ -434,11 +457,9 @@ void DragonTalon::Set(std::shared_ptr<nt::NetworkTable> nt, double value)
 				break;
 
 			case ControlModes::CONTROL_TYPE::MOTION_PROFILE:
-				ctreMode = ctre::phoenix::motorcontrol::ControlMode::MotionProfile;
-				break;
-
 			case ControlModes::CONTROL_TYPE::MOTION_PROFILE_ARC:
-				ctreMode = ctre::phoenix::motorcontrol::ControlMode::MotionProfileArc;
+				// no profile has been streamed, so hold the target position
+				ctreMode = ctre::phoenix::motorcontrol::ControlMode::Position;
 				break;
 
 			default:
@@ -472,6 +493,11 @@ void DragonTalon::Set(std::shared_ptr<nt::NetworkTable> nt, double value)
 				}
 				break;
 			
+			case ControlModes::CONTROL_TYPE::MOTION_PROFILE:
+			case ControlModes::CONTROL_TYPE::MOTION_PROFILE_ARC:
+				output = PositionToCounts(value);
+				break;
+
 			case ControlModes::CONTROL_TYPE::VELOCITY_DEGREES:
 				if (m_countsPerDegree > 0.01)
 				{
@@ -727,7 +753,9 @@ void DragonTalon::SetControlConstants(int slot, ControlData* controlInfo)
 		 controlInfo->GetMode() == ControlModes::CONTROL_TYPE::VELOCITY_RPS  ||
 		 controlInfo->GetMode() == ControlModes::CONTROL_TYPE::VOLTAGE ||
 		 controlInfo->GetMode() == ControlModes::CONTROL_TYPE::CURRENT ||
-		 controlInfo->GetMode() == ControlModes::CONTROL_TYPE::TRAPEZOID )
+		 controlInfo->GetMode() == ControlModes::CONTROL_TYPE::TRAPEZOID ||
+		 controlInfo->GetMode() == ControlModes::CONTROL_TYPE::MOTION_PROFILE ||
+		 controlInfo->GetMode() == ControlModes::CONTROL_TYPE::MOTION_PROFILE_ARC )
 	{
 		error = m_talon.get()->Config_kP(slot, controlInfo->GetP());
 		if ( error != ErrorCode::OKAY )
@@ -784,6 +812,7 @@ void DragonTalon::SetForwardLimitSwitch
 	bool normallyOpen
 )
 {
+	m_forwardLimitSwitch = true;
 	LimitSwitchNormal type = normallyOpen ? LimitSwitchNormal::LimitSwitchNormal_NormallyOpen : LimitSwitchNormal::LimitSwitchNormal_NormallyClosed;
 	m_talon.get()->ConfigForwardLimitSwitchSource( LimitSwitchSource::LimitSwitchSource_FeedbackConnector, type, 0  );
 	m_talon.get()->OverrideLimitSwitchesEnable(true);
@@ -794,6 +823,7 @@ void DragonTalon::SetReverseLimitSwitch
 	bool normallyOpen
 )
 {
+	m_reverseLimitSwitch = true;
 	LimitSwitchNormal type = normallyOpen ? LimitSwitchNormal::LimitSwitchNormal_NormallyOpen : LimitSwitchNormal::LimitSwitchNormal_NormallyClosed;
 	m_talon.get()->ConfigReverseLimitSwitchSource( LimitSwitchSource::LimitSwitchSource_FeedbackConnector, type, 0  );
 	m_talon.get()->OverrideLimitSwitchesEnable(true);
@@ -885,4 +915,164 @@ void DragonTalon::EnableDisableLimitSwitches
 )
 {
 	m_talon.get()->OverrideLimitSwitchesEnable(enable);
-}
\ No newline at end of file
+}
+
+void DragonTalon::SetSoftLimits
+(
+	bool	enableForward,
+	double	forwardLimit,
+	bool	enableReverse,
+	double	reverseLimit
+)
+{
+	m_forwardSoftLimitPosition = enableForward ? forwardLimit : numeric_limits<double>::max();
+	m_reverseSoftLimitPosition = enableReverse ? reverseLimit : numeric_limits<double>::lowest();
+
+	auto prompt = string("Dragon Talon");
+	prompt += to_string(m_talon.get()->GetDeviceID());
+
+	auto error = m_talon.get()->ConfigForwardSoftLimitThreshold(PositionToCounts(forwardLimit), 0);
+	if ( error != ErrorCode::OKAY )
+	{
+		Logger::GetLogger()->LogError(prompt, string("ConfigForwardSoftLimitThreshold error"));
+	}
+	error = m_talon.get()->ConfigForwardSoftLimitEnable(enableForward, 0);
+	if ( error != ErrorCode::OKAY )
+	{
+		Logger::GetLogger()->LogError(prompt, string("ConfigForwardSoftLimitEnable error"));
+		enableForward = false;
+	}
+
+	error = m_talon.get()->ConfigReverseSoftLimitThreshold(PositionToCounts(reverseLimit), 0);
+	if ( error != ErrorCode::OKAY )
+	{
+		Logger::GetLogger()->LogError(prompt, string("ConfigReverseSoftLimitThreshold error"));
+	}
+	error = m_talon.get()->ConfigReverseSoftLimitEnable(enableReverse, 0);
+	if ( error != ErrorCode::OKAY )
+	{
+		Logger::GetLogger()->LogError(prompt, string("ConfigReverseSoftLimitEnable error"));
+		enableReverse = false;
+	}
+
+	m_talon.get()->OverrideSoftLimitsEnable(enableForward || enableReverse);
+	m_forwardSoftLimit = enableForward;
+	m_reverseSoftLimit = enableReverse;
+}
+
+void DragonTalon::SetClearPositionOnLimitSwitch
+(
+	bool	forward,
+	bool	reverse
+)
+{
+	auto prompt = string("Dragon Talon");
+	prompt += to_string(m_talon.get()->GetDeviceID());
+
+	auto error = m_talon.get()->ConfigClearPositionOnLimitF(forward, 0);
+	if ( error != ErrorCode::OKAY )
+	{
+		Logger::GetLogger()->LogError(prompt, string("ConfigClearPositionOnLimitF error"));
+	}
+	error = m_talon.get()->ConfigClearPositionOnLimitR(reverse, 0);
+	if ( error != ErrorCode::OKAY )
+	{
+		Logger::GetLogger()->LogError(prompt, string("ConfigClearPositionOnLimitR error"));
+	}
+}
+
+/// @brief  Convert a mechanism position (degrees if counts per degree is set, otherwise inches) to 
+///         sensor counts;  inches are converted the same way as POSITION_INCH targets
+double DragonTalon::PositionToCounts
+(
+	double	position
+) const
+{
+	if (m_countsPerInch > 0.01)
+	{
+		return m_countsPerInch * position;
+	}
+	if (m_countsPerDegree > 0.01)
+	{
+		return m_countsPerDegree * position;
+	}
+	return ConversionUtils::InchesToCounts(position, m_countsPerRev, m_diameter) * m_gearRatio;
+}
+
+bool DragonTalon::StartMotionProfile
+(
+	const vector<MotionProfilePoint>&	points
+)
+{
+	auto prompt = string("Dragon Talon");
+	prompt += to_string(m_talon.get()->GetDeviceID());
+
+	m_profileActive = false;
+	if ( points.empty() )
+	{
+		return false;
+	}
+
+	m_talon.get()->ClearMotionProfileTrajectories();
+	m_talon.get()->ClearMotionProfileHasUnderrun(0);
+	m_profileStream.Clear();
+
+	ctre::phoenix::motion::TrajectoryPoint point;
+	point.arbFeedFwd = 0.0;
+	point.auxiliaryPos = 0.0;
+	point.auxiliaryVel = 0.0;
+	point.auxiliaryArbFeedFwd = 0.0;
+	point.profileSlotSelect0 = 0;
+	point.profileSlotSelect1 = 0;
+	point.zeroPos = false;
+	point.useAuxPID = false;
+	for ( auto inx=0U; inx<points.size(); ++inx )
+	{
+		point.position = PositionToCounts(points[inx].position);
+		point.velocity = PositionToCounts(points[inx].velocity) * 0.1;  // counts per 100 ms
+		point.timeDur = points[inx].durationMs;
+		point.isLastPoint = (inx + 1) == points.size();
+		auto error = m_profileStream.Write(point);
+		if ( error != ErrorCode::OKAY )
+		{
+			Logger::GetLogger()->LogError(prompt, string("BufferedTrajectoryPointStream Write error"));
+			return false;
+		}
+	}
+
+	// start once a few points are on the controller so it doesn't underrun at the beginning
+	const uint32_t minBufferedPoints = 5;
+	auto error = m_talon.get()->StartMotionProfile(m_profileStream, minBufferedPoints, ControlMode::MotionProfile);
+	if ( error != ErrorCode::OKAY )
+	{
+		Logger::GetLogger()->LogError(prompt, string("StartMotionProfile error"));
+		return false;
+	}
+	m_profileActive = true;
+	return true;
+}
+
+MotionProfileProgress DragonTalon::GetMotionProfileProgress()
+{
+	MotionProfileProgress progress = {m_profileActive, false, false, 0};
+	if ( m_profileActive )
+	{
+		ctre::phoenix::motion::MotionProfileStatus status;
+		m_talon.get()->GetMotionProfileStatus(status);
+		progress.finished = m_talon.get()->IsMotionProfileFinished();
+		progress.hasUnderrun = status.hasUnderrun;
+		progress.pointsRemaining = status.topBufferCnt + status.btmBufferCnt;
+		if ( status.hasUnderrun )
+		{
+			m_talon.get()->ClearMotionProfileHasUnderrun(0);
+		}
+	}
+	return progress;
+}
+
+void DragonTalon::StopMotionProfile()
+{
+	m_talon.get()->ClearMotionProfileTrajectories();
+	m_profileStream.Clear();
+	m_profileActive = false;
+}
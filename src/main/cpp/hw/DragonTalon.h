@@ -29,6 +29,7 @@
 // Third Party Includes
 #include <ctre/phoenix/motorcontrol/RemoteSensorSource.h>
 #include <ctre/phoenix/ErrorCode.h>
+#include <ctre/phoenix/motion/BufferedTrajectoryPointStream.h>
 #include <ctre/phoenix/motorcontrol/can/WPI_TalonSRX.h>
 
 
@@ -60,6 +61,7 @@ class DragonTalon : public IDragonMotorController
         int GetID() const override;
         std::shared_ptr<frc::MotorController> GetSpeedController() const override;
         double GetCurrent() const override;
+        double GetMotorOutputPercent() const override;
         IDragonMotorController::MOTOR_TYPE GetMotorType() const override;
 
         // Setters (override)
@@ -154,6 +156,28 @@ class DragonTalon : public IDragonMotorController
         (
             bool enable
         ) override;
+        void SetSoftLimits
+        (
+            bool    enableForward,
+            double  forwardLimit,
+            bool    enableReverse,
+            double  reverseLimit
+        ) override;
+        void SetClearPositionOnLimitSwitch
+        (
+            bool    forward,
+            bool    reverse
+        ) override;
+        bool IsForwardLimitEnforced() const override { return m_forwardLimitSwitch || m_forwardSoftLimit; }
+        bool IsReverseLimitEnforced() const override { return m_reverseLimitSwitch || m_reverseSoftLimit; }
+        double GetForwardSoftLimit() const override { return m_forwardSoftLimitPosition; }
+        double GetReverseSoftLimit() const override { return m_reverseSoftLimitPosition; }
+        bool StartMotionProfile
+        (
+            const std::vector<MotionProfilePoint>&  points
+        ) override;
+        MotionProfileProgress GetMotionProfileProgress() override;
+        void StopMotionProfile() override;
 
 
     private:
@@ -170,6 +194,16 @@ class DragonTalon : public IDragonMotorController
         double m_countsPerInch;
         double m_countsPerDegree;
         IDragonMotorController::MOTOR_TYPE m_motorType;
+        bool m_forwardLimitSwitch;
+        bool m_reverseLimitSwitch;
+        bool m_forwardSoftLimit;
+        bool m_reverseSoftLimit;
+        double m_forwardSoftLimitPosition;
+        double m_reverseSoftLimitPosition;
+        bool m_profileActive;
+        ctre::phoenix::motion::BufferedTrajectoryPointStream m_profileStream;
+
+        double PositionToCounts( double position ) const;
 };
 
 typedef std::vector<DragonTalon*> DragonTalonVector;
\ No newline at end of file
@@ -15,10 +15,21 @@
 
 /// --------------------------------------------------------------------------------------------
 /// @class MotorData
-/// @brief 
-///        Createing a motor data class to get the stall current, free current, etc. of a motor.
+/// @brief
+///        Motor data to get the stall current, free current, etc. of a motor.  The specs live in
+///        a constexpr table indexed by IDragonMotorController::MOTOR_TYPE, so lookups fold to
+///        constants.  The derived DC motor constants (resistance, Kv, Kt) and the model helpers
+///        can be used for feedforward, current prediction and simulation.
+///
+///        Units:  current in amps, speed in RPM (spec) or radians per second (model), torque in
+///                newton-meters, power in watts and voltage in volts.
 /// --------------------------------------------------------------------------------------------
 #pragma once
+
+// C++ Includes
+#include <array>
+#include <memory>
+
 // Third Party Includes
 
 //302 includes
@@ -26,119 +37,185 @@
 
 class MotorData
 {
-
-
-
     public:
-
-
-
-    int getStallCurrent(IDragonMotorController::MOTOR_TYPE motorType) const;
-    double getFreeCurrent(IDragonMotorController::MOTOR_TYPE motorType) const;
-    int getFreeSpeed(IDragonMotorController::MOTOR_TYPE motorType) const;
-    int getMaximumPower(IDragonMotorController::MOTOR_TYPE motorType) const;
-    double getStallTorque(IDragonMotorController::MOTOR_TYPE motorType) const;
-    bool checkIfStall(std::shared_ptr<IDragonMotorController> motor);
-    static MotorData* GetInstance();
+        /// @brief spec sheet values for a motor at the nominal voltage
+        struct MotorSpec
+        {
+            double  stallCurrent;   // amps
+            double  freeCurrent;    // amps
+            double  freeSpeed;      // RPM
+            double  maximumPower;   // watts
+            double  stallTorque;    // newton-meters
+        };
+
+        /// @brief voltage the spec sheet values were measured at
+        static constexpr double NOMINAL_VOLTAGE = 12.0;
+
+        MotorData() = delete;
+        ~MotorData() = delete;
+
+        /// @brief  Return the spec sheet values for the motor type
+        /// @param [in] IDragonMotorController::MOTOR_TYPE motorType - motor to look up
+        /// @return const MotorSpec& - spec values (all zero for NONE or an invalid type)
+        static constexpr const MotorSpec& GetSpec(IDragonMotorController::MOTOR_TYPE motorType)
+        {
+            return (motorType >= IDragonMotorController::FALCON500 && motorType < IDragonMotorController::NONE) ?
+                        m_specs[motorType] : m_specs[IDragonMotorController::NONE];
+        }
+
+        static constexpr int getStallCurrent(IDragonMotorController::MOTOR_TYPE motorType) { return static_cast<int>(GetSpec(motorType).stallCurrent); }
+        static constexpr double getFreeCurrent(IDragonMotorController::MOTOR_TYPE motorType) { return GetSpec(motorType).freeCurrent; }
+        static constexpr int getFreeSpeed(IDragonMotorController::MOTOR_TYPE motorType) { return static_cast<int>(GetSpec(motorType).freeSpeed); }
+        static constexpr int getMaximumPower(IDragonMotorController::MOTOR_TYPE motorType) { return static_cast<int>(GetSpec(motorType).maximumPower); }
+        static constexpr double getStallTorque(IDragonMotorController::MOTOR_TYPE motorType) { return GetSpec(motorType).stallTorque; }
+
+        /// @brief  Determine if the motor is drawing at least 90% of its stall current
+        /// @param [in] std::shared_ptr<IDragonMotorController> motor - motor to check
+        /// @return bool - true if the motor is stalled
+        static bool checkIfStall(std::shared_ptr<IDragonMotorController> motor);
+
+        //-------------  Derived DC motor constants
+
+        /// @brief  Free speed of the motor
+        /// @return double - free speed in radians per second
+        static constexpr double GetFreeSpeedRadPerSec(IDragonMotorController::MOTOR_TYPE motorType)
+        {
+            return GetSpec(motorType).freeSpeed * 2.0 * PI / 60.0;
+        }
+
+        /// @brief  Winding resistance (V = I * R at stall)
+        /// @return double - resistance in ohms (0.0 if there is no stall current data)
+        static constexpr double GetResistance(IDragonMotorController::MOTOR_TYPE motorType)
+        {
+            auto stall = GetSpec(motorType).stallCurrent;
+            return stall > 0.0 ? NOMINAL_VOLTAGE / stall : 0.0;
+        }
+
+        /// @brief  Velocity constant
+        /// @return double - radians per second per volt of back EMF
+        static constexpr double GetKv(IDragonMotorController::MOTOR_TYPE motorType)
+        {
+            auto emf = NOMINAL_VOLTAGE - GetResistance(motorType) * GetSpec(motorType).freeCurrent;
+            return emf > 0.0 ? GetFreeSpeedRadPerSec(motorType) / emf : 0.0;
+        }
+
+        /// @brief  Torque constant
+        /// @return double - newton-meters per amp
+        static constexpr double GetKt(IDragonMotorController::MOTOR_TYPE motorType)
+        {
+            auto stall = GetSpec(motorType).stallCurrent;
+            return stall > 0.0 ? GetSpec(motorType).stallTorque / stall : 0.0;
+        }
+
+        //-------------  DC motor model
+
+        /// @brief  Predict the current drawn by one motor
+        /// @param [in] IDragonMotorController::MOTOR_TYPE motorType - motor
+        /// @param [in] double speed - motor shaft speed in radians per second
+        /// @param [in] double voltage - applied voltage
+        /// @return double - current in amps
+        static constexpr double GetCurrent
+        (
+            IDragonMotorController::MOTOR_TYPE  motorType,
+            double                              speed,
+            double                              voltage
+        )
+        {
+            auto r  = GetResistance(motorType);
+            auto kv = GetKv(motorType);
+            return (r > 0.0 && kv > 0.0) ? (voltage - speed / kv) / r : 0.0;
+        }
+
+        /// @brief  Feedforward voltage needed to hold a speed while producing a torque
+        /// @param [in] IDragonMotorController::MOTOR_TYPE motorType - motor
+        /// @param [in] double speed - motor shaft speed in radians per second
+        /// @param [in] double torque - total torque required at the motor shafts in newton-meters
+        /// @param [in] int numMotors - number of motors sharing the load
+        /// @return double - voltage to apply
+        static constexpr double GetFeedforwardVoltage
+        (
+            IDragonMotorController::MOTOR_TYPE  motorType,
+            double                              speed,
+            double                              torque,
+            int                                 numMotors = 1
+        )
+        {
+            auto kt = GetKt(motorType);
+            auto kv = GetKv(motorType);
+            if ( kt <= 0.0 || kv <= 0.0 || numMotors < 1 )
+            {
+                return 0.0;
+            }
+            return (torque / (kt * numMotors)) * GetResistance(motorType) + speed / kv;
+        }
+
+        /// @brief  Angular acceleration of the mechanism output driven by the motor(s)
+        /// @param [in] IDragonMotorController::MOTOR_TYPE motorType - motor
+        /// @param [in] double outputSpeed - mechanism output speed in radians per second
+        /// @param [in] double voltage - applied voltage
+        /// @param [in] double moi - moment of inertia at the output in kg*m^2
+        /// @param [in] double reduction - motor rotations per output rotation
+        /// @param [in] int numMotors - number of motors driving the output
+        /// @return double - output acceleration in radians per second squared
+        static constexpr double GetAcceleration
+        (
+            IDragonMotorController::MOTOR_TYPE  motorType,
+            double                              outputSpeed,
+            double                              voltage,
+            double                              moi,
+            double                              reduction,
+            int                                 numMotors = 1
+        )
+        {
+            if ( moi <= 0.0 )
+            {
+                return 0.0;
+            }
+            auto current = GetCurrent(motorType, outputSpeed * reduction, voltage);
+            return GetKt(motorType) * current * numMotors * reduction / moi;
+        }
+
+        /// @brief  Advance a simulated mechanism output speed by one time step
+        /// @param [in] double dt - time step in seconds
+        /// @return double - output speed in radians per second after the step
+        static constexpr double SimulateSpeed
+        (
+            IDragonMotorController::MOTOR_TYPE  motorType,
+            double                              outputSpeed,
+            double                              voltage,
+            double                              moi,
+            double                              reduction,
+            double                              dt,
+            int                                 numMotors = 1
+        )
+        {
+            return outputSpeed + GetAcceleration(motorType, outputSpeed, voltage, moi, reduction, numMotors) * dt;
+        }
 
     private:
-     MotorData() = default;
-    ~MotorData() = default;
-
-    const int stallCurrentValues[18] = {257, //Falcon 500
-                                        166, //NEO Motor
-                                        111, //NEO 550 Motor
-                                        131, //CIM Motor
-                                        89,  //Mini CIM Motor
-                                        53,  //BAG Motor
-                                        134, //775pro Motor
-                                        71,  //AndyMark 9015
-                                        10,  //AndyMark NeveRest
-                                        18,  //AndyMark RS775-125
-                                        122, //AndyMark Redline A
-                                        11,  //REV Robotgics HD Hex Motor
-                                        97,  //BaneBots RS-775 18V
-                                        84,  //BaneBots RS-550
-                                        11,  //Modern Robotics 12VDC Motor
-                                        21,  //Johnson Electric Gear Motor
-                                        9,   //TETRIX MAX TorqueNADO Motor
-                                        0};  //No motor
-
-    const double freeCurrentValues[18] = {1.5, //Falcon 500
-                                        1.3, //NEO Motor
-                                        1.1, //NEO 550 Motor
-                                        2.7, //CIM Motor
-                                        3,  //Mini CIM Motor
-                                        1.8,  //BAG Motor
-                                        0.7, //775pro Motor
-                                        3.7,  //AndyMark 9015
-                                        0.4,  //AndyMark NeveRest
-                                        1.6,  //AndyMark RS775-125
-                                        2.6, //AndyMark Redline A
-                                        0.3,  //REV Robotgics HD Hex Motor
-                                        2.7,  //BaneBots RS-775 18V
-                                        0.4,  //BaneBots RS-550
-                                        0.3,  //Modern Robotics 12VDC Motor
-                                        0.9,  //Johnson Electric Gear Motor
-                                        0.2,   //TETRIX MAX TorqueNADO Motor
-                                        0};  //No motor
-
-    const int maximumPowerValues[18] = {783, //Falcon 500
-                                        516, //NEO Motor
-                                        332, //NEO 550 Motor
-                                        337, //CIM Motor
-                                        215,  //Mini CIM Motor
-                                        149,  //BAG Motor
-                                        347, //775pro Motor
-                                        134,  //AndyMark 9015
-                                        25,  //AndyMark NeveRest
-                                        43,  //AndyMark RS775-125
-                                        327, //AndyMark Redline A
-                                        28,  //REV Robotgics HD Hex Motor
-                                        246,  //BaneBots RS-775 18V
-                                        190,  //BaneBots RS-550
-                                        29,  //Modern Robotics 12VDC Motor
-                                        45,  //Johnson Electric Gear Motor
-                                        26,   //TETRIX MAX TorqueNADO Motor
-                                        0};  //No motor
-
-    const double stallTorqueValues[18] = {4.69, //Falcon 500
-                                        3.36, //NEO Motor
-                                        1.08, //NEO 550 Motor
-                                        2.41, //CIM Motor
-                                        1.41,  //Mini CIM Motor
-                                        0.43,  //BAG Motor
-                                        0.71, //775pro Motor
-                                        0.36,  //AndyMark 9015
-                                        0.17,  //AndyMark NeveRest
-                                        0.28,  //AndyMark RS775-125
-                                        0.64, //AndyMark Redline A
-                                        0.182,  //REV Robotgics HD Hex Motor
-                                        0.72,  //BaneBots RS-775 18V
-                                        0.38,  //BaneBots RS-550
-                                        0.19,  //Modern Robotics 12VDC Motor
-                                        4.09,  //Johnson Electric Gear Motor
-                                        0.17,   //TETRIX MAX TorqueNADO Motor
-                                        0};  //No motor
-
-    const int freeSpeedValues[18] = {6380, //Falcon 500
-                                        5880, //NEO Motor
-                                        11710, //NEO 550 Motor
-                                        5330, //CIM Motor
-                                        5840,  //Mini CIM Motor
-                                        13180,  //BAG Motor
-                                        18730, //775pro Motor
-                                        14270,  //AndyMark 9015
-                                        5480,  //AndyMark NeveRest
-                                        5800,  //AndyMark RS775-125
-                                        19500, //AndyMark Redline A
-                                        5960,  //REV Robotgics HD Hex Motor
-                                        13050,  //BaneBots RS-775 18V
-                                        19000,  //BaneBots RS-550
-                                        5900,  //Modern Robotics 12VDC Motor
-                                        420,  //Johnson Electric Gear Motor
-                                        5920,   //TETRIX MAX TorqueNADO Motor
-                                        0};  //No motor
-
-    static MotorData* m_instance;
-};
\ No newline at end of file
+        static constexpr double PI = 3.14159265358979323846;
+
+        //                                                          stall   free   free     max    stall
+        //                                                          amps    amps   RPM      watts  torque
+        static constexpr std::array<MotorSpec, IDragonMotorController::NONE + 1> m_specs =
+        {{
+            { 257.0, 1.5,  6380.0,  783.0, 4.69  },  //Falcon 500
+            { 166.0, 1.3,  5880.0,  516.0, 3.36  },  //NEO Motor
+            { 111.0, 1.1,  11710.0, 332.0, 1.08  },  //NEO 550 Motor
+            { 131.0, 2.7,  5330.0,  337.0, 2.41  },  //CIM Motor
+            { 89.0,  3.0,  5840.0,  215.0, 1.41  },  //Mini CIM Motor
+            { 53.0,  1.8,  13180.0, 149.0, 0.43  },  //BAG Motor
+            { 134.0, 0.7,  18730.0, 347.0, 0.71  },  //775pro Motor
+            { 71.0,  3.7,  14270.0, 134.0, 0.36  },  //AndyMark 9015
+            { 10.0,  0.4,  5480.0,  25.0,  0.17  },  //AndyMark NeveRest
+            { 18.0,  1.6,  5800.0,  43.0,  0.28  },  //AndyMark RS775-125
+            { 122.0, 2.6,  19500.0, 327.0, 0.64  },  //AndyMark Redline A
+            { 11.0,  0.3,  5960.0,  28.0,  0.182 },  //REV Robotics HD Hex Motor
+            { 97.0,  2.7,  13050.0, 246.0, 0.72  },  //BaneBots RS-775 18V
+            { 84.0,  0.4,  19000.0, 190.0, 0.38  },  //BaneBots RS-550
+            { 11.0,  0.3,  5900.0,  29.0,  0.19  },  //Modern Robotics 12VDC Motor
+            { 21.0,  0.9,  420.0,   45.0,  4.09  },  //Johnson Electric Gear Motor
+            { 9.0,   0.2,  5920.0,  26.0,  0.17  },  //TETRIX MAX TorqueNADO Motor
+            { 0.0,   0.0,  0.0,     0.0,   0.0   }   //No motor
+        }};
+};
@@ -6,6 +6,7 @@
 #include <hw/usages/MotorControllerUsage.h>
 #include <hw/DragonTalon.h>
 #include <hw/DragonFalcon.h>
+#include <hw/DragonCANBus.h>
 #include <utils/Logger.h>
 
 #include <ctre/phoenix/motorcontrol/can/TalonSRX.h>
@@ -65,9 +66,16 @@ shared_ptr<IDragonMotorController> DragonMotorControllerFactory::CreateMotorCont
     bool											forwardLimitSwitchNormallyOpen,
     bool											reverseLimitSwitch,
     bool											reverseLimitSwitchNormallyOpen,
+    bool											enableForwardSoftLimit,
+    double											forwardSoftLimit,
+    bool											enableReverseSoftLimit,
+    double											reverseSoftLimit,
+    bool											clearPositionOnForwardLimit,
+    bool											clearPositionOnReverseLimit,
     double											voltageCompensationSaturation,
     bool											enableVoltageCompensation,
-    IDragonMotorController::MOTOR_TYPE                                                          motorType
+    IDragonMotorController::MOTOR_TYPE                                                          motorType,
+    string                                          canBusName
 
 )
 {
@@ -78,6 +86,15 @@ shared_ptr<IDragonMotorController> DragonMotorControllerFactory::CreateMotorCont
     auto type = m_typeMap.find(mtype)->second;
     if ( type == MOTOR_TYPE::TALONSRX )
     {
+        // Talon SRXs are only supported on the roboRIO bus
+        auto bus = DragonCANBus::GetBusName( canBusName, string(DragonCANBus::RIO_BUS) );
+        if ( bus != string(DragonCANBus::RIO_BUS) )
+        {
+            string msg = usage + string(" is a TALONSRX and can't be on bus ") + bus;
+            Logger::GetLogger()->LogError( string("DragonMotorControllerFactory::CreateMotorController"), msg );
+        }
+        DragonCANBus::GetInstance()->AddDevice( string(DragonCANBus::RIO_BUS), canID, DragonCANBus::CAN_DEVICE_TYPE::TALON_SRX, usage );
+
         auto talon = new DragonTalon( MotorControllerUsage::GetInstance()->GetUsage(usage), canID, pdpID, countsPerRev, gearRatio, countsPerInch, countsPerDegree, motorType);
         talon->EnableBrakeMode( brakeMode );
         talon->Invert( inverted );
@@ -97,6 +114,8 @@ shared_ptr<IDragonMotorController> DragonMotorControllerFactory::CreateMotorCont
         {
             talon->SetReverseLimitSwitch(reverseLimitSwitchNormallyOpen);
         }
+        talon->SetClearPositionOnLimitSwitch( clearPositionOnForwardLimit, clearPositionOnReverseLimit );
+        talon->SetSoftLimits( enableForwardSoftLimit, forwardSoftLimit, enableReverseSoftLimit, reverseSoftLimit );
 
         if ( followMotor > -1 )
         {
@@ -111,7 +130,10 @@ shared_ptr<IDragonMotorController> DragonMotorControllerFactory::CreateMotorCont
     }
     else if ( type == MOTOR_TYPE::FALCON )
     {
-        auto talon = new DragonFalcon( MotorControllerUsage::GetInstance()->GetUsage(usage), canID, pdpID, countsPerRev, gearRatio, countsPerInch, countsPerDegree, motorType);
+        auto bus = DragonCANBus::GetBusName( canBusName, string(DragonCANBus::CANIVORE_BUS) );
+        DragonCANBus::GetInstance()->AddDevice( bus, canID, DragonCANBus::CAN_DEVICE_TYPE::TALON_FX, usage );
+
+        auto talon = new DragonFalcon( MotorControllerUsage::GetInstance()->GetUsage(usage), canID, bus, pdpID, countsPerRev, gearRatio, countsPerInch, countsPerDegree, motorType);
         talon->EnableBrakeMode( brakeMode );
         talon->Invert( inverted );
         /**
@@ -128,6 +150,8 @@ shared_ptr<IDragonMotorController> DragonMotorControllerFactory::CreateMotorCont
         {
             talon->SetReverseLimitSwitch(reverseLimitSwitchNormallyOpen);
         }
+        talon->SetClearPositionOnLimitSwitch( clearPositionOnForwardLimit, clearPositionOnReverseLimit );
+        talon->SetSoftLimits( enableForwardSoftLimit, forwardSoftLimit, enableReverseSoftLimit, reverseSoftLimit );
         
         if ( followMotor > -1 )
         {
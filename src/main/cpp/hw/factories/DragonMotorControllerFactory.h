@@ -95,9 +95,16 @@ class DragonMotorControllerFactory
 			bool											forwardLimitSwitchNormallyOpen,
 			bool											reverseLimitSwitch,
 			bool											reverseLimitSwitchNormallyOpen,
+			bool											enableForwardSoftLimit,	/// controller stops forward motion at forwardSoftLimit
+			double											forwardSoftLimit,		/// forward soft limit (inches or degrees)
+			bool											enableReverseSoftLimit,	/// controller stops reverse motion at reverseSoftLimit
+			double											reverseSoftLimit,		/// reverse soft limit (inches or degrees)
+			bool											clearPositionOnForwardLimit,	/// zero the sensor when the forward limit switch closes
+			bool											clearPositionOnReverseLimit,	/// zero the sensor when the reverse limit switch closes
 			double											voltageCompensationSaturation,
 			bool											enableVoltageCompensation,
-			IDragonMotorController::MOTOR_TYPE                       				motorType
+			IDragonMotorController::MOTOR_TYPE                       				motorType,
+			std::string										canBusName				/// CAN bus the controller is on (empty uses the default for the controller type)
 		);
 
 	private:
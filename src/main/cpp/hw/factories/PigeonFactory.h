@@ -17,6 +17,7 @@
 #pragma once
 
 // C++ Includes
+#include <string>
 
 // FRC includes
 
@@ -48,6 +49,7 @@ class PigeonFactory
         DragonPigeon* CreatePigeon
 		( 
 			int canID, 
+			const std::string& canBusName,
 			DragonPigeon::PIGEON_TYPE type, 
 			DragonPigeon::PIGEON_USAGE usage, 
 			double rotation 
@@ -19,6 +19,7 @@
 // C++ Includes
 #include <map>
 #include <memory>
+#include <vector>
 
 // FRC includes
 #include <frc/motorcontrol/MotorController.h>
@@ -28,6 +29,7 @@
 #include <hw/usages/MotorControllerUsage.h>
 #include <controllers/ControlModes.h>
 #include <controllers/ControlData.h>
+#include <controllers/MotionProfilePoint.h>
 
 // Third Party Includes
 #include <ctre/phoenix/motorcontrol/RemoteSensorSource.h>
@@ -90,6 +92,10 @@ class IDragonMotorController
         /// @return double - amperage usage for the controller
         virtual double GetCurrent() const = 0;
 
+        /// @brief  Return the output the controller is applying
+        /// @return double - fraction of full output (-1.0 to 1.0)
+        virtual double GetMotorOutputPercent() const = 0;
+
         /// @brief  Return the CAN ID
         /// @return int - CAN ID
         virtual int GetID() const = 0;
@@ -162,6 +168,65 @@ class IDragonMotorController
             bool enable
         ) = 0;
 
+        /// @brief  Configure the travel limits the controller enforces itself.  Positions are in 
+        ///         mechanism units:  degrees if counts per degree is set (and counts per inch isn't),
+        ///         otherwise inches, converted like POSITION_INCH targets.
+        /// @param [in] bool    enableForward - enable the forward soft limit
+        /// @param [in] double  forwardLimit - forward soft limit position
+        /// @param [in] bool    enableReverse - enable the reverse soft limit
+        /// @param [in] double  reverseLimit - reverse soft limit position
+        /// @return void
+        virtual void SetSoftLimits
+        (
+            bool    enableForward,
+            double  forwardLimit,
+            bool    enableReverse,
+            double  reverseLimit
+        ) = 0;
+
+        /// @brief  Have the controller zero its sensor position when a limit switch closes
+        /// @param [in] bool    forward - zero when the forward limit switch closes
+        /// @param [in] bool    reverse - zero when the reverse limit switch closes
+        /// @return void
+        virtual void SetClearPositionOnLimitSwitch
+        (
+            bool    forward,
+            bool    reverse
+        ) = 0;
+
+        /// @brief  Indicates whether the controller stops forward motion on its own (soft limit or limit switch)
+        /// @return bool - true if the forward travel limit is enforced by the controller
+        virtual bool IsForwardLimitEnforced() const = 0;
+
+        /// @brief  Indicates whether the controller stops reverse motion on its own (soft limit or limit switch)
+        /// @return bool - true if the reverse travel limit is enforced by the controller
+        virtual bool IsReverseLimitEnforced() const = 0;
+
+        /// @brief  Forward soft limit from the robot definition (whether or not the controller accepted it)
+        /// @return double - position in the SetSoftLimits units (std::numeric_limits<double>::max() if there isn't one)
+        virtual double GetForwardSoftLimit() const = 0;
+
+        /// @brief  Reverse soft limit from the robot definition (whether or not the controller accepted it)
+        /// @return double - position in the SetSoftLimits units (std::numeric_limits<double>::lowest() if there isn't one)
+        virtual double GetReverseSoftLimit() const = 0;
+
+        /// @brief  Load the points into the controller's buffered trajectory and start running them.  
+        ///         The points are streamed to the controller in the background and executed at its rate.
+        /// @param [in] const std::vector<MotionProfilePoint>& points - profile in mechanism units
+        /// @return bool - true if the profile was started
+        virtual bool StartMotionProfile
+        (
+            const std::vector<MotionProfilePoint>&  points
+        ) = 0;
+
+        /// @brief  Return the status of the buffered motion profile;  clears the sticky underrun flag
+        /// @return MotionProfileProgress - progress of the running profile
+        virtual MotionProfileProgress GetMotionProfileProgress() = 0;
+
+        /// @brief  Clear the buffered motion profile
+        /// @return void
+        virtual void StopMotionProfile() = 0;
+
     protected:
 
 };
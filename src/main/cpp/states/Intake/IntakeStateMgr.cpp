@@ -60,7 +60,7 @@ void IntakeStateMgr::CheckForStateTransition()
 
         if (targetState != currentState)
         {
-            SetCurrentState(targetState, true);
+            SetCurrentState(targetState, true, StateTrace::TRIGGER::INPUT);
         }
     } 
 }
@@ -43,12 +43,13 @@ class IntakeStateMgr : public StateMgr
             MAX_INTAKE_STATES
         };
 
-        const std::string m_intakeOffXmlString = "INTAKE_OFF";
-        const std::string m_intakeIntakeXmlString = "INTAKE_ON";
-        const std::string m_intakeExpelXmlString = "INTAKE_EXPEL";
-        const std::string m_intakeRetractXmlString = "INTAKE_RETRACT";
+        // static, so the auton parser can use them before the intakes are created
+        static inline const std::string m_intakeOffXmlString = "INTAKE_OFF";
+        static inline const std::string m_intakeIntakeXmlString = "INTAKE_ON";
+        static inline const std::string m_intakeExpelXmlString = "INTAKE_EXPEL";
+        static inline const std::string m_intakeRetractXmlString = "INTAKE_RETRACT";
         
-        const std::map<const std::string, INTAKE_STATE> m_intakeXmlStringToStateEnumMap
+        static inline const std::map<const std::string, INTAKE_STATE> m_intakeXmlStringToStateEnumMap
         {   {m_intakeOffXmlString, INTAKE_STATE::OFF},
             {m_intakeIntakeXmlString, INTAKE_STATE::INTAKE},
             {m_intakeExpelXmlString, INTAKE_STATE::EXPEL}
@@ -90,7 +90,7 @@ Mech1MotorState::Mech1MotorState
                 break;
 
             case ControlModes::CONTROL_TYPE::MOTION_PROFILE:
-                m_positionBased = false;
+                m_positionBased = true;
                 m_speedBased = false;
                 break;
 
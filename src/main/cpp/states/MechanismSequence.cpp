@@ -0,0 +1,74 @@
+
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302 
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF 
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, 
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE 
+// OR OTHER DEALINGS IN THE SOFTWARE.
+
+// C++ Includes
+#include <cmath>
+#include <exception>
+#include <string>
+
+// FRC includes
+
+// Team 302 includes
+#include <hw/factories/PigeonFactory.h>
+#include <states/MechanismSequence.h>
+#include <utils/Logger.h>
+
+// Third Party Includes
+
+using namespace std;
+
+void MechanismSequence::promise_type::unhandled_exception()
+{
+    // the sequence ends (it is at its final suspend point), the robot keeps running
+    try
+    {
+        rethrow_exception( current_exception() );
+    }
+    catch ( const exception& e )
+    {
+        Logger::GetLogger()->LogError( string("MechanismSequence"), string("sequence stopped: ") + e.what() );
+    }
+    catch ( ... )
+    {
+        Logger::GetLogger()->LogError( string("MechanismSequence"), string("sequence stopped") );
+    }
+}
+
+bool MechanismSequence::Resume()
+{
+    if ( !IsRunning() )
+    {
+        return false;
+    }
+
+    auto& promise = m_handle.promise();
+    if ( promise.check == nullptr || promise.check( promise.wait ) )
+    {
+        promise.check = nullptr;
+        promise.wait = nullptr;
+        m_handle.resume();
+    }
+    return !m_handle.done();
+}
+
+bool MechanismSequence::IsPitchWithin
+(
+    double              pitch,
+    double              tolerance
+)
+{
+    auto pigeon = PigeonFactory::GetFactory()->GetCenterPigeon();
+    return pigeon == nullptr || abs( pigeon->GetPitch() - pitch ) <= tolerance;
+}
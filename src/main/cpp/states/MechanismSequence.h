@@ -0,0 +1,208 @@
+
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302 
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF 
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, 
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE 
+// OR OTHER DEALINGS IN THE SOFTWARE.
+
+#pragma once
+
+// C++ Includes
+#include <coroutine>
+#include <utility>
+
+// FRC includes
+#include <frc/Timer.h>
+#include <units/time.h>
+
+// Team 302 includes
+#include <states/IState.h>
+
+// Third Party Includes
+
+
+/// @class MechanismSequence
+/// @brief A mechanism behavior written as one C++20 coroutine, e.g. a multi-bar climb:
+///
+///            MechanismSequence Climb()
+///            {
+///                SetCurrentState( CLIMB_MID_BAR, true );
+///                if ( !co_await MechanismSequence::AtTarget( GetCurrentStatePtr(), 3_s ) ) co_return;
+///                ...
+///            }
+///
+///        The sequence runs up to its first co_await on the first Resume.  After that, each Resume
+///        (once per loop) only checks the condition it is waiting on and continues to the next
+///        co_await when it is met.  A co_await returns true if its condition was met and false if it
+///        timed out.  The wait is kept in the coroutine frame, so resuming doesn't allocate; the frame
+///        is allocated once when the sequence is created and freed when it is destroyed or replaced
+///        (which also cancels it).
+class MechanismSequence
+{
+    public:
+        struct promise_type
+        {
+            bool        (*check)(void* wait) = nullptr;    // condition the sequence is waiting on
+            void*       wait = nullptr;
+
+            MechanismSequence get_return_object() { return MechanismSequence( std::coroutine_handle<promise_type>::from_promise(*this) ); }
+            std::suspend_always initial_suspend() noexcept { return {}; }
+            std::suspend_always final_suspend() noexcept { return {}; }
+            void return_void() {}
+            void unhandled_exception();
+        };
+
+        /// @brief  Wait until a condition is true or a timeout expires
+        /// @tparam Condition - callable returning bool
+        template <typename Condition>
+        class Wait
+        {
+            public:
+                /// @param [in] Condition condition - checked once per loop while the sequence waits
+                /// @param [in] units::second_t timeout - give up after this long (0 waits forever)
+                Wait
+                (
+                    Condition           condition,
+                    units::second_t     timeout
+                ) : m_condition(std::move(condition)),
+                    m_timeout(timeout),
+                    m_start(),
+                    m_met(false)
+                {
+                }
+
+                bool await_ready()
+                {
+                    m_met = m_condition();
+                    return m_met;
+                }
+
+                void await_suspend
+                (
+                    std::coroutine_handle<promise_type>     handle
+                )
+                {
+                    m_start = frc::Timer::GetFPGATimestamp();
+                    handle.promise().check = &Wait::Check;
+                    handle.promise().wait = this;
+                }
+
+                /// @return bool - true if the condition was met, false if the wait timed out
+                bool await_resume() const { return m_met; }
+
+            private:
+                static bool Check
+                (
+                    void*               wait
+                )
+                {
+                    auto self = static_cast<Wait*>(wait);
+                    self->m_met = self->m_condition();
+                    return self->m_met || 
+                           ( self->m_timeout > units::second_t(0.0) && frc::Timer::GetFPGATimestamp() - self->m_start >= self->m_timeout );
+                }
+
+                Condition           m_condition;
+                units::second_t     m_timeout;
+                units::second_t     m_start;
+                bool                m_met;
+        };
+
+        /// @brief  Wait for a state's targets to be reached
+        static auto AtTarget
+        (
+            const IState*       state,
+            units::second_t     timeout
+        )
+        {
+            return Wait( [state]() { return state == nullptr || state->AtTarget(); }, timeout );
+        }
+
+        /// @brief  Wait for the robot pitch (center pigeon) to be within tolerance degrees of pitch
+        static auto PitchWithin
+        (
+            double              pitch,
+            double              tolerance,
+            units::second_t     timeout
+        )
+        {
+            return Wait( [pitch, tolerance]() { return IsPitchWithin(pitch, tolerance); }, timeout );
+        }
+
+        /// @brief  Wait for a fixed time (the co_await returns false)
+        static auto Delay
+        (
+            units::second_t     time
+        )
+        {
+            return Wait( []() { return false; }, time );
+        }
+
+        /// @brief  Is the robot pitch (center pigeon) within tolerance degrees of pitch.  True if
+        ///         there isn't a pigeon, so a robot without one doesn't get stuck.
+        static bool IsPitchWithin
+        (
+            double              pitch,
+            double              tolerance
+        );
+
+        MechanismSequence() = default;
+        MechanismSequence(const MechanismSequence&) = delete;
+        MechanismSequence& operator=(const MechanismSequence&) = delete;
+        MechanismSequence
+        (
+            MechanismSequence&& other
+        ) noexcept : m_handle( std::exchange(other.m_handle, nullptr) )
+        {
+        }
+        MechanismSequence& operator=
+        (
+            MechanismSequence&& other
+        ) noexcept
+        {
+            if ( this != &other )
+            {
+                Destroy();
+                m_handle = std::exchange(other.m_handle, nullptr);
+            }
+            return *this;
+        }
+        ~MechanismSequence() { Destroy(); }
+
+        /// @brief  Run the sequence if the condition it is waiting on is met (call once per loop)
+        /// @return bool - true if the sequence is still running
+        bool Resume();
+
+        /// @brief  Is there a sequence that hasn't finished
+        bool IsRunning() const { return m_handle && !m_handle.done(); }
+
+        /// @brief  Stop the sequence where it is
+        void Cancel() { Destroy(); }
+
+    private:
+        explicit MechanismSequence
+        (
+            std::coroutine_handle<promise_type>     handle
+        ) : m_handle(handle)
+        {
+        }
+
+        void Destroy()
+        {
+            if ( m_handle )
+            {
+                m_handle.destroy();
+                m_handle = nullptr;
+            }
+        }
+
+        std::coroutine_handle<promise_type>     m_handle;
+};
@@ -14,11 +14,13 @@
 //====================================================================================================================================================
 
 // C++ Includes
+#include <algorithm>
 #include <map>
 #include <memory>
 #include <vector>
 
 // FRC includes
+#include <frc/Timer.h>
 #include <networktables/NetworkTableInstance.h>
 #include <networktables/NetworkTable.h>
 #include <networktables/NetworkTableEntry.h>
@@ -38,9 +40,12 @@
 #include <states/shooter/ShooterStateManual.h>
 #include <states/StateMgr.h>
 #include <states/StateStruc.h>
+#include <states/StateTrace.h>
 #include <subsys/interfaces/IMech.h>
 #include <subsys/MechanismFactory.h>
+#include <utils/Arena.h>
 #include <utils/Logger.h>
+#include <xmlmechdata/StateDataCache.h>
 #include <xmlmechdata/StateDataDefn.h>
 
 // Third Party Includes
@@ -51,10 +56,25 @@ using namespace std;
 
 /// @brief    initialize the state manager, parse the configuration file and create the states.
 StateMgr::StateMgr() : m_mech(nullptr),
+                       m_stateMap(),
                        m_currentState(),
                        m_stateVector(),
                        m_currentStateID(0)
 {
+    // the states are in the configuration arena, so forget them when it is reset
+    Arena::GetConfigArena()->AddResetHandler([this]() 
+    { 
+        m_currentState = nullptr;
+        fill(m_stateVector.begin(), m_stateVector.end(), nullptr);
+    });
+    // and create them again from the configuration file when it is rebuilt
+    Arena::GetConfigArena()->AddRebuildHandler([this]() 
+    { 
+        if (m_mech != nullptr)
+        {
+            Init(m_mech, m_stateMap);
+        }
+    });
 }
 void StateMgr::Init
 (
@@ -63,15 +83,19 @@ void StateMgr::Init
 ) 
 {
     m_mech = mech;
-
+    if (&stateMap != &m_stateMap)
+    {
+        m_stateMap = stateMap;
+    }
 
     if (mech != nullptr)
     {
-        // Parse the configuration file 
-        auto stateXML = make_unique<StateDataDefn>();
-        vector<MechanismTargetData*> targetData = stateXML.get()->ParseXML(mech->GetType());
+        StateTrace::GetInstance()->AddManager(mech->GetType(), mech->GetNetworkTableName(), stateMap);
+
+        // Get the parsed configuration file (shared with the other managers that use the file)
+        auto stateData = StateDataCache::GetInstance()->GetStateData(mech->GetControlFileName());
 
-        if (targetData.empty())
+        if (stateData == nullptr || stateData->targetData.empty())
         {
             Logger::GetLogger()->LogError(Logger::LOGGER_LEVEL::ERROR, mech->GetControlFileName(), string("No states"));
         }
@@ -79,9 +103,11 @@ void StateMgr::Init
         {
             // initialize the xml string to state map
             m_stateVector.resize(stateMap.size());
+            ReserveStates(stateMap.size());
             // create the states passing the configuration data
-            for ( auto td: targetData )
+            for ( auto& targetData : stateData->targetData )
             {
+                auto td = &targetData;
                 auto stateString = td->GetStateString();
                 auto stateStringToStrucItr = stateMap.find( stateString );
                 if ( stateStringToStrucItr != stateMap.end() )
@@ -90,101 +116,7 @@ void StateMgr::Init
                     auto slot = struc.id;
                     if ( m_stateVector[slot] == nullptr )
                     {
-                        auto controlData = td->GetController();
-                	    auto controlData2 = td->GetController2();
-                        auto target = td->GetTarget();
-                	    auto secondaryTarget = td->GetSecondTarget();
-                        auto robotPitch = td->GetRobotPitch();
-                        auto function1Coeff = td->GetFunction1Coeff();
-                        auto function2Coeff = td->GetFunction2Coeff();
-                        auto type = struc.type;
-                        IState* thisState = nullptr;
-                        switch (type)
-                        {
-                            case StateType::LEFT_INTAKE:
-                        	    thisState = new IntakeState(MechanismFactory::GetMechanismFactory()->GetLeftIntake(),
-                                                            controlData,
-                                                            controlData2, 
-                                                            target, 
-                                                            secondaryTarget);
-                        	    break;
-
-                            case StateType::LEFT_INTAKE_MANUAL:
-                        	    thisState = new ManualLeftIntakeState(MechanismFactory::GetMechanismFactory()->GetLeftIntake(),
-                                                                                                controlData,
-                                                                                                controlData2, 
-                                                                                                target, 
-                                                                                                secondaryTarget);
-                        	    break;
-
-                            case StateType::RIGHT_INTAKE:
-                        	    thisState = new IntakeState(MechanismFactory::GetMechanismFactory()->GetRightIntake(),
-                                                            controlData,
-                                                            controlData2, 
-                                                            target, 
-                                                            secondaryTarget);
-                        	    break;
-
-                            case StateType::RIGHT_INTAKE_MANUAL:
-                        	    thisState = new ManualRightIntakeState(MechanismFactory::GetMechanismFactory()->GetRightIntake(),
-                                                                                                controlData,
-                                                                                                controlData2, 
-                                                                                                target, 
-                                                                                                secondaryTarget);
-                        	    break;
-                        	    
-                    	    case StateType::SHOOTER:
-                       		    thisState = new ShooterState(controlData, 
-                                                             controlData2, 
-                                                             target, 
-                                                             secondaryTarget);
-                       		    break;
-
-                    	    case StateType::SHOOTER_MANUAL:
-                       		    thisState = new ShooterStateManual();
-                       		    break;
-
-                    	    case StateType::SHOOTER_AUTO:
-                       		    thisState = new ShooterStateAutoHigh(controlData, 
-                                                                     controlData2, 
-                                                                     target, 
-                                                                     secondaryTarget, 
-                                                                     function1Coeff, 
-                                                                     function2Coeff);
-                       		    break;
-
-                            case StateType::CLIMBER:
-                                thisState = new ClimberState(controlData, 
-                                                             controlData2, 
-                                                             target, 
-                                                             secondaryTarget,
-                                                             robotPitch);
-                                break;
-
-                            case StateType::CLIMBER_MANUAL:
-                                thisState = new ClimberManualState(controlData, 
-                                                                   controlData2, 
-                                                                   target, 
-                                                                   secondaryTarget);
-                                break;
-
-
-                            case StateType::INDEXER:
-                                thisState = new IndexerState(MechanismFactory::GetMechanismFactory()->GetIndexer(), 
-                                                             controlData, 
-                                                             controlData2,
-                                                             target,
-                                                             secondaryTarget);
-                                break;
-                                
-                            case StateType::LIFT:
-                                thisState = new LiftState(MechanismFactory::GetMechanismFactory()->GetLift(), controlData, target);
-                                break;
-
-                    	    default:
-                        	    Logger::GetLogger()->LogError( string("StateMgr::StateMgr"), string("unknown state"));
-                    	        break;
-                	    }
+                        auto thisState = CreateState(struc, td);
                 	    if (thisState != nullptr)
                 	    {
                     	    m_stateVector[slot] = thisState;
@@ -210,6 +142,110 @@ void StateMgr::Init
     }
 }
 
+/// @brief  create a state in the configuration arena;  the mechanisms are initialized one at a time, 
+///         so each mechanism's states are next to each other in memory
+/// @return IState* - the state (nullptr if the type isn't known)
+IState* StateMgr::CreateState
+(
+    const StateStruc&               struc,
+    const MechanismTargetData*      td
+)
+{
+    auto arena = Arena::GetConfigArena();
+    auto controlData = td->GetController();
+    auto controlData2 = td->GetController2();
+    auto target = td->GetTarget();
+    auto secondaryTarget = td->GetSecondTarget();
+
+    IState* thisState = nullptr;
+    switch (struc.type)
+    {
+        case StateType::LEFT_INTAKE:
+            thisState = arena->Create<IntakeState>(MechanismFactory::GetMechanismFactory()->GetLeftIntake(),
+                                                   controlData,
+                                                   controlData2, 
+                                                   target, 
+                                                   secondaryTarget);
+            break;
+
+        case StateType::LEFT_INTAKE_MANUAL:
+            thisState = arena->Create<ManualLeftIntakeState>(MechanismFactory::GetMechanismFactory()->GetLeftIntake(),
+                                                             controlData,
+                                                             controlData2, 
+                                                             target, 
+                                                             secondaryTarget);
+            break;
+
+        case StateType::RIGHT_INTAKE:
+            thisState = arena->Create<IntakeState>(MechanismFactory::GetMechanismFactory()->GetRightIntake(),
+                                                   controlData,
+                                                   controlData2, 
+                                                   target, 
+                                                   secondaryTarget);
+            break;
+
+        case StateType::RIGHT_INTAKE_MANUAL:
+            thisState = arena->Create<ManualRightIntakeState>(MechanismFactory::GetMechanismFactory()->GetRightIntake(),
+                                                              controlData,
+                                                              controlData2, 
+                                                              target, 
+                                                              secondaryTarget);
+            break;
+            
+        case StateType::SHOOTER:
+            thisState = arena->Create<ShooterState>(controlData, 
+                                                    controlData2, 
+                                                    target, 
+                                                    secondaryTarget);
+            break;
+
+        case StateType::SHOOTER_MANUAL:
+            thisState = arena->Create<ShooterStateManual>();
+            break;
+
+        case StateType::SHOOTER_AUTO:
+            thisState = arena->Create<ShooterStateAutoHigh>(controlData, 
+                                                            controlData2, 
+                                                            target, 
+                                                            secondaryTarget, 
+                                                            td->GetFunction1Coeff(), 
+                                                            td->GetFunction2Coeff());
+            break;
+
+        case StateType::CLIMBER:
+            thisState = arena->Create<ClimberState>(controlData, 
+                                                    controlData2, 
+                                                    target, 
+                                                    secondaryTarget,
+                                                    td->GetRobotPitch());
+            break;
+
+        case StateType::CLIMBER_MANUAL:
+            thisState = arena->Create<ClimberManualState>(controlData, 
+                                                          controlData2, 
+                                                          target, 
+                                                          secondaryTarget);
+            break;
+
+        case StateType::INDEXER:
+            thisState = arena->Create<IndexerState>(MechanismFactory::GetMechanismFactory()->GetIndexer(), 
+                                                    controlData, 
+                                                    controlData2,
+                                                    target,
+                                                    secondaryTarget);
+            break;
+            
+        case StateType::LIFT:
+            thisState = arena->Create<LiftState>(MechanismFactory::GetMechanismFactory()->GetLift(), controlData, target);
+            break;
+
+        default:
+            Logger::GetLogger()->LogError( string("StateMgr::CreateState"), string("unknown state"));
+            break;
+    }
+    return thisState;
+}
+
 /// @brief  run the current state
 /// @return void
 void StateMgr::RunCurrentState()
@@ -243,7 +279,8 @@ void StateMgr::CheckForStateTransition()
 void StateMgr::SetCurrentState
 (
     int             stateID,
-    bool            run
+    bool            run,
+    int             trigger
 )
 {
     if (m_mech != nullptr )
@@ -251,6 +288,11 @@ void StateMgr::SetCurrentState
         auto state = m_stateVector[stateID];
         if ( state != nullptr && state != m_currentState)
         {    
+            StateTrace::GetInstance()->Record(m_mech->GetType(), 
+                                              m_currentStateID, 
+                                              stateID, 
+                                              trigger, 
+                                              frc::Timer::GetFPGATimestamp().value());
             m_currentState = state;
             m_currentStateID = stateID;       
             m_currentState->Init();
@@ -18,6 +18,7 @@
 
 // C++ Includes
 #include <map>
+#include <string>
 #include <vector>
 
 // FRC includes
@@ -25,12 +26,15 @@
 // Team 302 includes
 #include <states/IState.h>
 #include <states/StateStruc.h>
+#include <states/StateTrace.h>
 #include <subsys/interfaces/IMech.h>
 #include <states/Mech2MotorState.h>
 
 
 // Third Party Includes
 
+class MechanismTargetData;
+
 class StateMgr 
 {
     public:
@@ -50,11 +54,13 @@ class StateMgr
         /// @brief  set the current state, initialize it and run it
         /// @param [in]     int - state to set
         /// @param [in]     run - true means run, false just initialize it
+        /// @param [in]     trigger - what caused the change (StateTrace::TRIGGER or a transition table row)
         /// @return void
         virtual void SetCurrentState
         (
             int         state,
-            bool        run
+            bool        run,
+            int         trigger = StateTrace::TRIGGER::DIRECT
         );
 
         /// @brief  return the current state
@@ -65,12 +71,34 @@ class StateMgr
     protected:
         virtual void CheckForStateTransition();
 
+        /// @brief  create the state for a state definition in the XML
+        /// @param [in]     const StateStruc& - the state's id and type
+        /// @param [in]     const MechanismTargetData* - the state's targets and control data
+        /// @return IState* - the state (nullptr if the type isn't known)
+        virtual IState* CreateState
+        (
+            const StateStruc&               struc,
+            const MechanismTargetData*      targetData
+        );
+
+        /// @brief  called before the states are created with the number of states
+        virtual void ReserveStates
+        (
+            size_t                          numStates
+        ) 
+        {
+        }
+
+        /// @brief  the mechanism (nullptr until Init is called with one)
+        inline IMech* GetMech() const { return m_mech; }
+
     private:
 
-        IMech*                  m_mech;
-        IState*                 m_currentState;
-        std::vector<IState*>    m_stateVector;
-        int                     m_currentStateID;
+        IMech*                                  m_mech;
+        std::map<std::string, StateStruc>       m_stateMap;     // kept to create the states again when the arena is rebuilt
+        IState*                                 m_currentState;
+        std::vector<IState*>                    m_stateVector;
+        int                                     m_currentStateID;
 
 };
 
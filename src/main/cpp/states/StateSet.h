@@ -0,0 +1,145 @@
+
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302 
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF 
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, 
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE 
+// OR OTHER DEALINGS IN THE SOFTWARE.
+
+#pragma once
+
+// C++ Includes
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+// FRC includes
+
+// Team 302 includes
+#include <states/IState.h>
+
+// Third Party Includes
+
+
+/// @class StateSet
+/// @brief The states of a state manager whose state classes are known at compile time.  Each slot
+///        holds one of the state classes by value (std::variant), the slots are in one array and
+///        Run/AtTarget dispatch on the variant index with qualified calls, so the calls are static and
+///        can be inlined instead of going through the IState vtable.
+/// @tparam States - the state classes (each derived from IState)
+template <typename... States>
+class StateSet
+{
+    public:
+        static_assert( sizeof...(States) > 0, "a StateSet needs at least one state class" );
+        static_assert( (std::is_base_of_v<IState, States> && ...), "the states must be derived from IState" );
+
+        StateSet() = default;
+        ~StateSet() = default;
+
+        /// @brief  Create the (empty) slots;  call once before the states are created
+        void Reserve
+        (
+            size_t      numStates
+        )
+        {
+            m_states = std::make_unique<State[]>( numStates );
+            m_size = numStates;
+        }
+
+        /// @brief  Create the state in a slot
+        /// @return T* - the state (nullptr if the slot isn't valid)
+        template <typename T, typename... Args>
+        T* Emplace
+        (
+            int         slot,
+            Args&&...   args
+        )
+        {
+            static_assert( (std::is_same_v<T, States> || ...), "the class isn't in the StateSet" );
+            return IsValid(slot) ? &m_states[slot].template emplace<T>( std::forward<Args>(args)... ) : nullptr;
+        }
+
+        /// @brief  Run the state in a slot
+        inline void Run
+        (
+            int         slot
+        )
+        {
+            if ( IsValid(slot) )
+            {
+                Dispatch( m_states[slot], []<typename T>(T& state) { state.T::Run(); } );
+            }
+        }
+
+        /// @brief  Has the state in a slot reached its target (false for an empty slot)
+        inline bool AtTarget
+        (
+            int         slot
+        ) const
+        {
+            auto atTarget = false;
+            if ( IsValid(slot) )
+            {
+                Dispatch( m_states[slot], [&atTarget]<typename T>(const T& state) { atTarget = state.T::AtTarget(); } );
+            }
+            return atTarget;
+        }
+
+        /// @brief  Destroy all of the states (the slots stay)
+        void Clear()
+        {
+            for ( size_t inx=0; inx<m_size; ++inx )
+            {
+                m_states[inx].template emplace<std::monostate>();
+            }
+        }
+
+        size_t Size() const { return m_size; }
+
+    private:
+        using State = std::variant<std::monostate, States...>;
+
+        inline bool IsValid
+        (
+            int         slot
+        ) const
+        {
+            return slot >= 0 && static_cast<size_t>(slot) < m_size;
+        }
+
+        /// @brief  call function with the class the slot holds (nothing for an empty slot)
+        template <typename Slot, typename Function>
+        static inline void Dispatch
+        (
+            Slot&       slot,
+            Function&&  function
+        )
+        {
+            DispatchTo( slot, function, std::index_sequence_for<States...>{} );
+        }
+
+        template <typename Slot, typename Function, size_t... Index>
+        static inline void DispatchTo
+        (
+            Slot&       slot,
+            Function&   function,
+            std::index_sequence<Index...>
+        )
+        {
+            auto index = slot.index();
+            (void)( ( index == Index + 1 ? ( function( *std::get_if<Index + 1>( &slot ) ), true ) : false ) || ... );
+        }
+
+        std::unique_ptr<State[]>    m_states;
+        size_t                      m_size = 0;
+};
@@ -0,0 +1,175 @@
+
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302 
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF 
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, 
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE 
+// OR OTHER DEALINGS IN THE SOFTWARE.
+
+// C++ Includes
+#include <cstdio>
+#include <fstream>
+#include <map>
+#include <string>
+
+// FRC includes
+#include <frc/Filesystem.h>
+
+// Team 302 includes
+#include <states/StateStruc.h>
+#include <states/StateTrace.h>
+#include <subsys/MechanismTypes.h>
+#include <utils/Logger.h>
+
+// Third Party Includes
+
+using namespace std;
+
+StateTrace* StateTrace::m_instance = nullptr;
+StateTrace* StateTrace::GetInstance()
+{
+    if ( StateTrace::m_instance == nullptr )
+    {
+        StateTrace::m_instance = new StateTrace();
+    }
+    return StateTrace::m_instance;
+}
+
+StateTrace::StateTrace() : m_entries(),
+                           m_count(0),
+                           m_dumped(0),
+                           m_names(),
+                           m_stateNames()
+{
+}
+
+void StateTrace::AddManager
+(
+    MechanismTypes::MECHANISM_TYPE          mechanism,
+    const string&                           name,
+    const map<string, StateStruc>&          stateMap
+)
+{
+    if ( mechanism > MechanismTypes::UNKNOWN_MECHANISM && mechanism < MechanismTypes::MAX_MECHANISM_TYPES )
+    {
+        m_names[mechanism] = name;
+        auto& stateNames = m_stateNames[mechanism];
+        for ( auto& [xmlString, struc] : stateMap )
+        {
+            if ( struc.id >= 0 )
+            {
+                if ( static_cast<size_t>(struc.id) >= stateNames.size() )
+                {
+                    stateNames.resize( struc.id + 1 );
+                }
+                stateNames[struc.id] = xmlString;
+            }
+        }
+    }
+}
+
+string StateTrace::ToString
+(
+    const Entry&    entry
+) const
+{
+    auto mech = entry.mechanism;
+    auto known = mech > MechanismTypes::UNKNOWN_MECHANISM && mech < MechanismTypes::MAX_MECHANISM_TYPES;
+    auto stateName = [this, known, mech](int state)
+    {
+        return ( known && state >= 0 && static_cast<size_t>(state) < m_stateNames[mech].size() && 
+                 !m_stateNames[mech][state].empty() ) ? m_stateNames[mech][state] : to_string(state);
+    };
+
+    string trigger;
+    switch ( entry.trigger )
+    {
+        case TRIGGER::DIRECT:
+            trigger = "robot";
+            break;
+
+        case TRIGGER::AUTON:
+            trigger = "auton";
+            break;
+
+        case TRIGGER::INPUT:
+            trigger = "input";
+            break;
+
+        case TRIGGER::SEQUENCE:
+            trigger = "sequence";
+            break;
+
+        default:
+            trigger = entry.trigger >= 0 ? string("row ") + to_string(entry.trigger) : to_string(entry.trigger);
+            break;
+    }
+
+    char line[256];
+    snprintf( line, sizeof(line), "%.3f,%s,%s,%s,%s",
+              entry.time,
+              ( known && !m_names[mech].empty() ) ? m_names[mech].c_str() : to_string(mech).c_str(),
+              stateName(entry.from).c_str(),
+              stateName(entry.to).c_str(),
+              trigger.c_str() );
+    return string(line);
+}
+
+void StateTrace::Dump()
+{
+    if ( m_dumped == m_count )
+    {
+        return;
+    }
+
+    auto logger = Logger::GetLogger();
+    string ntName("State Trace");
+
+    auto first = m_dumped > Oldest() ? m_dumped : Oldest();
+    if ( first > m_dumped )
+    {
+        logger->LogError( Logger::LOGGER_LEVEL::WARNING, string("StateTrace"), 
+                          to_string(first - m_dumped) + string(" transitions were overwritten before they were dumped") );
+    }
+
+    // the first dump after the robot starts begins a new file;  the last boot's trace is kept as 
+    // stateTrace.prev.csv (replacing the one before it) so it survives a reboot to look at it
+    auto dir = frc::filesystem::GetOperatingDirectory();
+    auto filename = dir + string("/stateTrace.csv");
+    if ( m_dumped == 0 )
+    {
+        rename( filename.c_str(), (dir + string("/stateTrace.prev.csv")).c_str() );
+    }
+    ofstream file( filename, m_dumped == 0 ? ios::trunc : ios::app );
+    if ( !file.is_open() )
+    {
+        logger->LogError( Logger::LOGGER_LEVEL::ERROR, string("StateTrace"), string("can't open ") + filename );
+    }
+    else if ( m_dumped == 0 )
+    {
+        file << "time,manager,from,to,trigger" << endl;
+    }
+
+    // the network table entries are the ring slots, so there are never more than CAPACITY of them 
+    // (Newest is the slot of the latest transition)
+    for ( auto inx=first; inx<m_count; ++inx )
+    {
+        auto slot = inx & (CAPACITY - 1);
+        auto line = ToString( m_entries[slot] );
+        logger->ToNtTable( ntName, to_string(slot), line );
+        if ( file.is_open() )
+        {
+            file << line << endl;
+        }
+    }
+    logger->ToNtTable( ntName, string("Transitions"), static_cast<double>(m_count) );
+    logger->ToNtTable( ntName, string("Newest"), static_cast<double>((m_count - 1) & (CAPACITY - 1)) );
+    m_dumped = m_count;
+}
@@ -0,0 +1,133 @@
+
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302 
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF 
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, 
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE 
+// OR OTHER DEALINGS IN THE SOFTWARE.
+
+#pragma once
+
+// C++ Includes
+#include <array>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+// FRC includes
+
+// Team 302 includes
+#include <states/StateStruc.h>
+#include <subsys/MechanismTypes.h>
+
+// Third Party Includes
+
+
+/// @class StateTrace
+/// @brief Records every state manager transition (time, mechanism, from state, to state and what 
+///        triggered it) in a fixed ring buffer, so a failed climb or shot can be reconstructed after 
+///        the match.  Recording is a store into the buffer and an index increment: nothing allocates,
+///        locks or formats until Dump, which writes the transitions since the last dump to the "State
+///        Trace" network table (one entry per ring slot) and appends them to stateTrace.csv in the
+///        operating directory (the previous boot's file is kept as stateTrace.prev.csv).  Record is
+///        called from the robot loop only.
+class StateTrace
+{
+    public:
+        /// @brief  Transitions kept (a power of two; older ones are overwritten)
+        static constexpr size_t CAPACITY = 256;
+
+        /// @brief  What caused a transition.  A value of 0 or more is the row of the manager's
+        ///         StateTransitionTable that fired.
+        enum TRIGGER
+        {
+            DIRECT = -1,        // SetCurrentState called by the robot code
+            AUTON = -2,         // an auton primitive set the state
+            INPUT = -3,         // the manager's own input checks
+            SEQUENCE = -4       // a MechanismSequence step
+        };
+
+        struct Entry
+        {
+            double      time;       // FPGA time in seconds
+            int8_t      mechanism;  // MechanismTypes::MECHANISM_TYPE
+            int8_t      from;
+            int8_t      to;
+            int16_t     trigger;    // TRIGGER or a transition table row
+        };
+
+        /// @brief  Find or create the singleton
+        /// @return StateTrace* - the trace
+        static StateTrace* GetInstance();
+
+        /// @brief  Give the names used when the trace is dumped (call when the manager is initialized)
+        /// @param [in] MechanismTypes::MECHANISM_TYPE mechanism - the manager's mechanism
+        /// @param [in] const std::string& name - manager name
+        /// @param [in] const std::map<std::string, StateStruc>& stateMap - xml state names to states
+        void AddManager
+        (
+            MechanismTypes::MECHANISM_TYPE                  mechanism,
+            const std::string&                              name,
+            const std::map<std::string, StateStruc>&        stateMap
+        );
+
+        /// @brief  Record a transition
+        inline void Record
+        (
+            MechanismTypes::MECHANISM_TYPE  mechanism,
+            int                             from,
+            int                             to,
+            int                             trigger,
+            double                          time
+        )
+        {
+            m_entries[m_count & (CAPACITY - 1)] = Entry{ time, 
+                                                         static_cast<int8_t>(mechanism), 
+                                                         static_cast<int8_t>(from), 
+                                                         static_cast<int8_t>(to), 
+                                                         static_cast<int16_t>(trigger) };
+            ++m_count;
+        }
+
+        /// @brief  Write the transitions recorded since the last dump to the network table and the
+        ///         trace file (call when the robot is disabled).  Does nothing if there are none.
+        void Dump();
+
+        /// @brief  Number of transitions recorded since the robot started (may be more than CAPACITY)
+        uint64_t Count() const { return m_count; }
+
+        /// @brief  Transition inx (0 is the oldest one still in the buffer)
+        const Entry& GetEntry(size_t inx) const { return m_entries[(Oldest() + inx) & (CAPACITY - 1)]; }
+
+        /// @brief  Number of transitions in the buffer
+        size_t Size() const { return m_count < CAPACITY ? static_cast<size_t>(m_count) : CAPACITY; }
+
+    private:
+        StateTrace();
+        ~StateTrace() = default;
+
+        uint64_t Oldest() const { return m_count - Size(); }
+
+        std::string ToString
+        (
+            const Entry&    entry
+        ) const;
+
+        static_assert( (CAPACITY & (CAPACITY - 1)) == 0, "CAPACITY must be a power of two" );
+
+        std::array<Entry, CAPACITY>                                             m_entries;
+        uint64_t                                                                m_count;
+        uint64_t                                                                m_dumped;   // transitions already dumped
+        std::array<std::string, MechanismTypes::MAX_MECHANISM_TYPES>            m_names;
+        std::array<std::vector<std::string>, MechanismTypes::MAX_MECHANISM_TYPES>   m_stateNames;
+
+        static StateTrace*                                                      m_instance;
+};
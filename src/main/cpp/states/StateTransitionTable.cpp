@@ -0,0 +1,105 @@
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302 
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+// C++ Includes
+#include <bit>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// FRC includes
+
+// Team 302 includes
+#include <states/StateTransitionTable.h>
+#include <utils/Logger.h>
+
+// Third Party Includes
+
+using namespace std;
+
+StateTransitionTable::StateTransitionTable
+(
+    vector<Transition>      transitions
+) : m_transitions(transitions),
+    m_rowsByState(),
+    m_lastInputs(0),
+    m_lastState(-1),
+    m_lastRow(-1),
+    m_recheck(false)
+{
+    if ( m_transitions.size() > MAX_TRANSITIONS )
+    {
+        Logger::GetLogger()->LogError( string("StateTransitionTable"), string("too many transitions; the extra ones are ignored") );
+        m_transitions.resize( MAX_TRANSITIONS );
+    }
+
+    for ( size_t row=0; row<m_transitions.size(); ++row )
+    {
+        for ( int state=0; state<MAX_STATES; ++state )
+        {
+            if ( (m_transitions[row].fromStates & StateBit(state)) != 0 )
+            {
+                m_rowsByState[state] |= uint64_t(1) << row;
+            }
+        }
+    }
+}
+
+int StateTransitionTable::Evaluate
+(
+    int             currentState,
+    uint32_t        inputs
+)
+{
+    auto released = m_lastInputs & ~inputs;
+    auto changed = inputs != m_lastInputs || currentState != m_lastState || m_recheck;
+    m_lastInputs = inputs;
+    m_lastState = currentState;
+    m_recheck = false;
+
+    if ( !changed || currentState < 0 || currentState >= MAX_STATES )
+    {
+        return currentState;
+    }
+
+    auto rows = m_rowsByState[currentState];
+    while ( rows != 0 )
+    {
+        auto row = countr_zero( rows );
+        rows &= rows - 1;
+
+        auto& transition = m_transitions[row];
+        if ( (inputs & transition.inputMask) == transition.inputValue &&
+             ( transition.released == 0 || (released & transition.released) != 0 ) )
+        {
+            if ( transition.guard && !transition.guard() )
+            {
+                m_recheck = true;
+                return currentState;
+            }
+            if ( transition.toState != currentState )
+            {
+                m_lastRow = static_cast<int>( row );
+            }
+            return transition.toState;
+        }
+    }
+    return currentState;
+}
+
+void StateTransitionTable::Reset()
+{
+    m_lastState = -1;
+}
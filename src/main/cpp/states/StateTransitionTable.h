@@ -0,0 +1,93 @@
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302 
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+#pragma once
+
+// C++ Includes
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+// FRC includes
+
+// Team 302 includes
+
+// Third Party Includes
+
+
+/// @class StateTransitionTable
+/// @brief Table of state transitions for a state manager.  Each row is (from states, input bits, guard,
+///        to state);  the manager packs its inputs (buttons, thresholds) into a bitmask each loop and
+///        the first row that applies to the current state and matches the inputs gives the next state.
+///        The table is only evaluated when the inputs or the state changed (or a guard blocked a
+///        transition last time), and the rows for each state are found with a bitmask, not a search.
+class StateTransitionTable
+{
+    public:
+        /// @brief  Most rows in a table and states a row can refer to
+        static constexpr size_t MAX_TRANSITIONS = 64;
+        static constexpr int    MAX_STATES = 32;
+
+        static constexpr uint32_t ALL_STATES = 0xFFFFFFFF;
+
+        /// @brief  Bit for a state in Transition::fromStates
+        static constexpr uint32_t StateBit(int state) { return 1U << state; }
+
+        struct Transition
+        {
+            uint32_t                fromStates;     // bit per state the row applies in
+            uint32_t                inputMask;      // input bits the row looks at
+            uint32_t                inputValue;     // values those bits must have
+            uint32_t                released;       // if not 0, one of these bits must have been released
+                                                    // since the last call (only matches on that loop)
+            std::function<bool()>   guard;          // extra condition (may be empty);  if it fails the
+                                                    // transition waits and no later row is checked
+            int                     toState;
+        };
+
+        /// @brief  Create the table
+        /// @param [in] std::vector<Transition> transitions - rows in priority order (at most MAX_TRANSITIONS)
+        explicit StateTransitionTable
+        (
+            std::vector<Transition>     transitions
+        );
+        StateTransitionTable() = delete;
+        ~StateTransitionTable() = default;
+
+        /// @brief  Find the next state
+        /// @param [in] int currentState - state the manager is in
+        /// @param [in] uint32_t inputs - input bits for this loop
+        /// @return int - state to change to (currentState if there is no transition)
+        int Evaluate
+        (
+            int             currentState,
+            uint32_t        inputs
+        );
+
+        /// @brief  Evaluate the table on the next call even if nothing changed
+        void Reset();
+
+        /// @brief  Row that gave the last transition Evaluate returned (-1 if it hasn't returned one)
+        int GetLastRow() const { return m_lastRow; }
+
+    private:
+        std::vector<Transition>                 m_transitions;
+        std::array<uint64_t, MAX_STATES>        m_rowsByState;      // bit per row that applies in the state
+        uint32_t                                m_lastInputs;
+        int                                     m_lastState;
+        int                                     m_lastRow;
+        bool                                    m_recheck;          // a guard blocked a transition
+};
@@ -0,0 +1,78 @@
+
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302 
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF 
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, 
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE 
+// OR OTHER DEALINGS IN THE SOFTWARE.
+
+#pragma once
+
+// C++ Includes
+#include <cstddef>
+
+// FRC includes
+
+// Team 302 includes
+#include <states/IState.h>
+#include <states/StateMgr.h>
+#include <states/StateSet.h>
+#include <utils/Arena.h>
+
+// Third Party Includes
+
+
+/// @class StaticStateMgr
+/// @brief A state manager with a fixed list of state classes.  The states are kept in a StateSet and
+///        RunCurrentState calls Derived::CheckForStateTransition and the current state's Run 
+///        statically, so the per-loop path has no virtual calls once the manager is called through
+///        its own (final) class.  Derived creates each state in m_states by overriding CreateState.
+/// @tparam Derived - the manager (CRTP);  it should be final
+/// @tparam States - the state classes it uses
+template <typename Derived, typename... States>
+class StaticStateMgr : public StateMgr
+{
+    public:
+        /// @brief  run the current state
+        void RunCurrentState() override
+        {
+            if ( GetMech() != nullptr )
+            {
+                static_cast<Derived*>(this)->Derived::CheckForStateTransition();
+                m_states.Run( GetCurrentState() );
+            }
+        }
+
+        /// @brief  has the current state reached its target
+        bool IsCurrentStateAtTarget() const
+        {
+            return m_states.AtTarget( GetCurrentState() );
+        }
+
+    protected:
+        StaticStateMgr() : StateMgr(),
+                           m_states()
+        {
+            // the base class forgets its pointers to the states when the configuration arena 
+            // is reset;  destroy the states too
+            Arena::GetConfigArena()->AddResetHandler( [this]() { m_states.Clear(); } );
+        }
+        ~StaticStateMgr() = default;
+
+        void ReserveStates
+        (
+            size_t      numStates
+        ) override
+        {
+            m_states.Reserve( numStates );
+        }
+
+        StateSet<States...>     m_states;
+};
@@ -18,6 +18,10 @@
 #include <memory>
 
 // FRC includes
+#include <frc/geometry/Pose2d.h>
+#include <frc/geometry/Rotation2d.h>
+#include <frc/geometry/Translation2d.h>
+#include <frc/kinematics/ChassisSpeeds.h>
 #include <units/velocity.h>
 #include <units/angular_velocity.h>
 
@@ -38,7 +42,9 @@ using namespace frc;
 SwerveDrive::SwerveDrive() : IState(),
                              m_chassis(ChassisFactory::GetChassisFactory()->GetSwerveChassis()),
                              m_controller(TeleopControl::GetInstance()),
-                             m_usePWLinearProfile(false)
+                             m_usePWLinearProfile(false),
+                             m_poseFollower(),
+                             m_targetFinder()
 {
     if (m_controller == nullptr)
     {
@@ -108,8 +114,47 @@ void SwerveDrive::Run()
         auto steer = controller->GetAxisValue(TeleopControl::FUNCTION_IDENTIFIER::SWERVE_DRIVE_STEER);
         auto rotate = controller->GetAxisValue(TeleopControl::FUNCTION_IDENTIFIER::SWERVE_DRIVE_ROTATE);
 
-        m_chassis->Drive(drive, steer, rotate, mode, headingOpt);
+        // drive to the shooting spot while the button is held; the trajectory is generated in the
+        // background and the driver keeps control until it is ready
+        auto driveToSpot = controller->IsButtonPressed(TeleopControl::DRIVE_TO_SHOOTING_SPOT);
+        if (driveToSpot && !m_poseFollower.IsActive())
+        {
+            m_poseFollower.Start(GetShootingSpot(m_chassis.get()->GetPose()));
+        }
+        else if (!driveToSpot && m_poseFollower.IsActive())
+        {
+            m_poseFollower.Stop();
+        }
+
+        ChassisSpeeds speeds;
+        if (m_poseFollower.Calculate(speeds))
+        {
+            m_chassis->Drive(speeds, IChassis::CHASSIS_DRIVE_MODE::ROBOT_ORIENTED, headingOpt);
+        }
+        else
+        {
+            m_chassis->Drive(drive, steer, rotate, mode, headingOpt);
+        }
+    }
+}
+
+/// @brief find the spot to shoot from that is closest to the robot
+/// @return frc::Pose2d - field pose facing the goal
+Pose2d SwerveDrive::GetShootingSpot
+(
+    const Pose2d&   currentPose
+)
+{
+    auto goal = m_targetFinder.GetPosCenterTarget().Translation();
+    auto offset = currentPose.Translation() - goal;
+    auto distance = offset.Norm().to<double>();
+    if (distance < 0.01)
+    {
+        offset = Translation2d(units::length::meter_t(1.0), units::length::meter_t(0.0));
+        distance = 1.0;
     }
+    auto spot = goal + offset * (SHOOTING_DISTANCE / distance);
+    return Pose2d(spot, Rotation2d(-offset.X().to<double>(), -offset.Y().to<double>()));
 }
 
 /// @brief indicates that we are not at our target
@@ -18,7 +18,11 @@
 //C++ Libraries
 #include <memory>
 
+//FRC includes
+#include <frc/geometry/Pose2d.h>
+
 //Team 302 includes
+#include <auton/PoseFollower.h>
 #include <subsys/SwerveChassis.h>
 #include <gamepad/TeleopControl.h>
 #include <states/IState.h>
@@ -41,7 +45,18 @@ class SwerveDrive : public IState
 
     private:
         inline TeleopControl* GetController() const { return m_controller; }
+
+        /// @brief  Spot SHOOTING_DISTANCE from the goal on the line from the goal to the robot, facing the goal
+        frc::Pose2d GetShootingSpot
+        (
+            const frc::Pose2d&  currentPose
+        );
+
+        const double                        SHOOTING_DISTANCE = 2.5;    // meters from the goal center
+
         std::shared_ptr<SwerveChassis>      m_chassis;
         TeleopControl*                      m_controller;
         bool                                m_usePWLinearProfile;     
+        PoseFollower                        m_poseFollower;
+        DragonTargetFinder                  m_targetFinder;
 };
\ No newline at end of file
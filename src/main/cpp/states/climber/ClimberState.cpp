@@ -25,6 +25,7 @@
 #include <states/Climber/ClimberState.h>
 #include <states/Mech2MotorState.h>
 #include <subsys/MechanismFactory.h>
+#include <utils/Arena.h>
 
 //Debugging
 #include <utils/Logger.h>
@@ -49,11 +50,21 @@ ClimberState::ClimberState
     m_liftTarget(target1),
     m_rotateTarget(target2),
     m_robotPitch(robotPitch),
-    m_liftController(new DragonPID(controlData)),
-    m_rotateController(new DragonPID(controlData2)),
+    m_liftController(Arena::GetConfigArena()->Create<DragonPID>(controlData)),
+    m_rotateController(Arena::GetConfigArena()->Create<DragonPID>(controlData2)),
     m_liftMotor(m_climber->GetPrimaryMotor()),
-    m_rotateMotor(m_climber->GetSecondaryMotor())
+    m_rotateMotor(m_climber->GetSecondaryMotor()),
+    m_liftProfile(),
+    m_rotateProfile()
 {
+    if (controlData != nullptr && controlData->GetMode() == ControlModes::CONTROL_TYPE::MOTION_PROFILE)
+    {
+        m_liftProfile = make_unique<DragonMotionProfile>(m_liftMotor, string("climberNT"));
+    }
+    if (controlData2 != nullptr && controlData2->GetMode() == ControlModes::CONTROL_TYPE::MOTION_PROFILE)
+    {
+        m_rotateProfile = make_unique<DragonMotionProfile>(m_rotateMotor, string("climberNT"));
+    }
 }
 
 void ClimberState::Init()
@@ -62,6 +73,16 @@ void ClimberState::Init()
     {
         m_climber->SetControlConstants(0, GetPrimaryControlData());
         m_climber->SetSecondaryControlConstants(0, GetSecondaryControlData());
+
+        // profiled moves are streamed to the controllers once; UpdateTargets then only records the targets
+        if (m_liftProfile.get() != nullptr)
+        {
+            m_liftProfile.get()->Start(GetLiftHeight(), m_liftTarget, m_liftControlData);
+        }
+        if (m_rotateProfile.get() != nullptr)
+        {
+            m_rotateProfile.get()->Start(GetRotateAngle(), m_rotateTarget, m_rotateControlData);
+        }
         m_climber->UpdateTargets(m_liftTarget, m_rotateTarget);
     }
 }
@@ -72,6 +93,15 @@ void ClimberState::Run()
     {
         Logger::GetLogger()->ToNtTable("climberNT", "Lift Height", GetLiftHeight());
         Logger::GetLogger()->ToNtTable("climberNT", "Rotate Angle", GetRotateAngle());
+
+        if (m_liftProfile.get() != nullptr)
+        {
+            m_liftProfile.get()->Update();
+        }
+        if (m_rotateProfile.get() != nullptr)
+        {
+            m_rotateProfile.get()->Update();
+        }
     }
 }
 
@@ -16,8 +16,12 @@
 
 #pragma once
 
+// C++ Includes
+#include <memory>
+
 //Team 302 Includes
 #include <controllers/ControlData.h>
+#include <controllers/DragonMotionProfile.h>
 #include <controllers/DragonPID.h>
 #include <controllers/MechanismTargetData.h>
 #include <states/Mech2MotorState.h>
@@ -63,4 +67,6 @@ class ClimberState : public Mech2MotorState
         DragonPID*                          m_rotateController;
         std::shared_ptr<IDragonMotorController>  m_liftMotor;
         std::shared_ptr<IDragonMotorController>  m_rotateMotor;
+        std::unique_ptr<DragonMotionProfile>     m_liftProfile;
+        std::unique_ptr<DragonMotionProfile>     m_rotateProfile;
 };
\ No newline at end of file
@@ -16,12 +16,14 @@
 // C++ Includes
 #include <map>
 #include <memory>
+#include <string>
 #include <vector>
 
 // FRC includes
 #include <networktables/NetworkTableInstance.h>
 #include <networktables/NetworkTable.h>
 #include <networktables/NetworkTableEntry.h>
+#include <units/time.h>
 
 // Team 302 includes
 #include <controllers/MechanismTargetData.h>
@@ -29,9 +31,12 @@
 #include <states/climber/ClimberState.h>
 #include <states/climber/ClimberStateMgr.h>
 #include <states/IState.h>
+#include <states/MechanismSequence.h>
+#include <states/StateTrace.h>
 #include <subsys/Climber.h>
 #include <subsys/MechanismFactory.h>
 #include <subsys/MechanismTypes.h>
+#include <utils/Arena.h>
 #include <utils/Logger.h>
 #include <xmlmechdata/StateDataDefn.h>
 
@@ -58,11 +63,18 @@ ClimberStateMgr* ClimberStateMgr::GetInstance()
 /// @brief    initialize the state manager, parse the configuration file and create the states.
 ClimberStateMgr::ClimberStateMgr() : m_climber(MechanismFactory::GetMechanismFactory()->GetClimber()),
                                      m_nt(),
-                                     m_wasAutoClimb(false),
                                      m_prevState(CLIMBER_STATE::UNINITIALIZED),
                                      m_hasZeroed(false),
-                                     m_currentAutoState(CLIMBER_STATE::CLIMB_MID_BAR),
-                                     m_autoTimer()
+                                     // the climb mode button must be held;  the initial reach button wins over the 
+                                     // manual inputs and the climber zeros if it hasn't done anything yet
+                                     m_transitions({
+                                        {StateTransitionTable::ALL_STATES, CLIMB_MODE, 0, 0, nullptr, CLIMBER_STATE::OFF},
+                                        {StateTransitionTable::ALL_STATES, CLIMB_MODE | INITIAL_REACH_INPUT, CLIMB_MODE | INITIAL_REACH_INPUT, 0, nullptr, CLIMBER_STATE::INITIAL_REACH},
+                                        {StateTransitionTable::ALL_STATES, CLIMB_MODE | MANUAL_INPUT, CLIMB_MODE | MANUAL_INPUT, 0, nullptr, CLIMBER_STATE::MANUAL},
+                                        {StateTransitionTable::ALL_STATES, CLIMB_MODE, CLIMB_MODE, 0, [this]() { return m_prevState == CLIMBER_STATE::UNINITIALIZED; }, CLIMBER_STATE::ZERO_BEFORE_CLIMB}
+                                     }),
+                                     m_autoClimb(),
+                                     m_autoClimbStarted(false)
 {
     if (m_climber != nullptr)
     {
@@ -92,6 +104,13 @@ ClimberStateMgr::ClimberStateMgr() : m_climber(MechanismFactory::GetMechanismFac
     stateMap[m_climberClimbTraversalXmlString] = m_climbTraversalState;
 
     Init(m_climber, stateMap);
+
+    // the automated climb holds a pointer to its current state, which is in the configuration arena
+    Arena::GetConfigArena()->AddResetHandler([this]() 
+    { 
+        m_autoClimb.Cancel(); 
+        m_autoClimbStarted = false;
+    });
 }
 
 /// @brief run the current state
@@ -103,143 +122,58 @@ void ClimberStateMgr::CheckForStateTransition()
     
     if (m_climber != nullptr )
     {
+        uint32_t inputs = 0;
         auto controller = TeleopControl::GetInstance();
-        auto isClimbMode  = controller != nullptr ? controller->IsButtonPressed(TeleopControl::FUNCTION_IDENTIFIER::ENABLE_CLIMBER) : false;
-
-        auto isAutoClimb = controller != nullptr ? controller->IsButtonPressed(TeleopControl::FUNCTION_IDENTIFIER::CLIMB_AUTO) : false;
-
-        auto isClimbManual = CheckForManualInput();
-        auto isClimbInitialReach = controller != nullptr ? controller->IsButtonPressed(TeleopControl::FUNCTION_IDENTIFIER::CLIMBER_STATE_INITIAL_REACH) : false;
-
-        
-        auto isZeroState = controller != nullptr ? controller->IsButtonPressed(TeleopControl::FUNCTION_IDENTIFIER::CLIMBER_STATE_BACK_ROTATE_A) : false;
-
-        if (isClimbMode)
+        if (controller != nullptr)
         {
-            // if (isAutoClimb)
-            // {
-            //     //Start at initial climb state by checking if this is the first loop the robot is auto climbing
-            //     if(!m_wasAutoClimb)
-            //     {
-            //         m_currentAutoState = CLIMBER_STATE::CLIMB_MID_BAR;
-            //         targetState = m_currentAutoState;
-            //         m_wasAutoClimb = true;
-            //     }
-            //     else
-            //     {
-            //             auto currentStatePtr = GetCurrentStatePtr();
-            //             if (currentStatePtr != nullptr)
-            //             {
-            //                 auto done = currentStatePtr->AtTarget();
-            //                 Logger::GetLogger()->ToNtTable(m_nt, string("AutoIsDone"), done);
-            //                 if (!done)
-            //                 {
-            //                     targetState = m_currentAutoState;
-            //                 }
-            //                 else if (done && currentState != CLIMB_TRAVERSAL_BAR)
-            //                 {
-            //                     m_autoTimer.Start();
-            //                     if(m_autoTimer.HasElapsed(units::time::second_t(0.5)))
-            //                     {
-            //                         targetState = static_cast<CLIMBER_STATE>(static_cast<int>(currentState)+1);
-            //                         m_currentAutoState = targetState;
-            //                         m_autoTimer.Stop();
-            //                         m_autoTimer.Reset();
-            //                     }
-            //                 }
-            //                 m_prevState = targetState;
-
-            //                 //Debugging
-            //                 Logger::GetLogger()->ToNtTable(m_nt, string("m_currentAutoState"), m_currentAutoState);
-            //                 Logger::GetLogger()->ToNtTable(m_nt, string("m_wasAutoClimb"), m_wasAutoClimb);
-            //             }        
-            //     }  
-            // }  
-            //Needs testing
-            if (m_prevState == CLIMBER_STATE::UNINITIALIZED)
-            {
-                /*
-                if (GetCurrentState() == CLIMBER_STATE::ZERO_BEFORE_CLIMB)
-                {
-                    auto currentStatePtr = GetCurrentStatePtr();
-                    if (currentStatePtr != nullptr)
-                    {
-                        if (currentStatePtr->AtTarget())
-                        {
-                            m_hasZeroed = true;
-                        }
-                    }
-                }
-                */
-                targetState = CLIMBER_STATE::ZERO_BEFORE_CLIMB;
-            }
-            // else
-            // {
-            //     targetState = CLIMBER_STATE::MANUAL;
-            // }
+            inputs |= controller->IsButtonPressed(TeleopControl::FUNCTION_IDENTIFIER::ENABLE_CLIMBER) ? CLIMB_MODE : 0;
+            inputs |= CheckForManualInput() ? MANUAL_INPUT : 0;
+            inputs |= controller->IsButtonPressed(TeleopControl::FUNCTION_IDENTIFIER::CLIMBER_STATE_INITIAL_REACH) ? INITIAL_REACH_INPUT : 0;
+            inputs |= controller->IsButtonPressed(TeleopControl::FUNCTION_IDENTIFIER::CLIMB_AUTO) ? AUTO_CLIMB_INPUT : 0;
+        }
 
-            if(isClimbManual)
-            {
-                targetState = CLIMBER_STATE::MANUAL;
-            }
+        if ((inputs & CLIMB_MODE) == 0)
+        {
+            m_prevState = CLIMBER_STATE::OFF;
+            m_autoClimbStarted = false;
+        }
 
-            if (isClimbInitialReach)
+        // the automated climb runs while climb mode is held and nothing else is requested;  
+        // it starts once the climber has zeroed and only once each time climb mode is held, so 
+        // it doesn't start over when it finishes (or stops on a time out) with the button held.
+        // It never starts while the climber is part way through a climb.
+        auto otherInputs = MANUAL_INPUT | INITIAL_REACH_INPUT;
+        auto isClimbing = currentState >= CLIMBER_STATE::CLIMB_MID_BAR && currentState <= CLIMBER_STATE::CLIMB_TRAVERSAL_BAR;
+        if (m_autoClimb.IsRunning())
+        {
+            if ((inputs & CLIMB_MODE) != 0 && (inputs & otherInputs) == 0)
             {
-                targetState = CLIMBER_STATE::INITIAL_REACH;
+                m_autoClimb.Resume();
+                return;
             }
-
-            //Debugging
-            // if (isStateA)
-            // {
-            //     targetState = CLIMBER_STATE::CLIMB_MID_BAR;
-            // } 
-            // else if (isStateB)   
-            // {
-            //     targetState = CLIMBER_STATE::PREPARE_EXTEND_MID_BAR;
-            // }
-            // else if (isStateC)   
-            // {
-            //     targetState = CLIMBER_STATE::EXTEND_MID_BAR;
-            // }   
-            // else if (isStateD)   
-            // {
-            //     targetState = CLIMBER_STATE::ROTATE_MID_BAR;
-            // }   
-            // else if (isStateE)   
-            // {
-            //     targetState = CLIMBER_STATE::REACH_HIGH_BAR;    
-            // }   
-            // else if (isStateF)   
-            // {
-            //     targetState = CLIMBER_STATE::CLIMB_HIGH_BAR;
-            // }   
-            // else if (isStateG)   
-            // {
-            //     targetState = CLIMBER_STATE::PREPARE_EXTEND_HIGH_BAR;
-            // }    
-            // else if (isStateH)  
-            // {
-            //     targetState = CLIMBER_STATE::EXTEND_HIGH_BAR;
-            // }    
-            // else if (isStateI)
-            // {
-            //     //targetState = CLIMBER_STATE::CLIMB_TRAVERSAL_BAR;
-            //     targetState = CLIMBER_STATE::EXTEND_HIGH_BAR;
-            // }
+            m_autoClimb.Cancel();
         }
-        else
+        else if ((inputs & (CLIMB_MODE | AUTO_CLIMB_INPUT | otherInputs)) == (CLIMB_MODE | AUTO_CLIMB_INPUT) &&
+                 !m_autoClimbStarted && 
+                 !isClimbing &&
+                 currentState != CLIMBER_STATE::UNINITIALIZED &&
+                 GetCurrentStatePtr() != nullptr &&
+                 (currentState != CLIMBER_STATE::ZERO_BEFORE_CLIMB || GetCurrentStatePtr()->AtTarget()))
         {
-            m_prevState = CLIMBER_STATE::OFF;
-            m_wasAutoClimb = false;
-            targetState = CLIMBER_STATE::OFF;
+            m_autoClimbStarted = true;
+            m_autoClimb = AutoClimb();
+            m_autoClimb.Resume();
+            return;
         }
 
+        targetState = static_cast<CLIMBER_STATE>(m_transitions.Evaluate(currentState, inputs));
+
         Logger::GetLogger()->ToNtTable(m_nt, string("state"), targetState);
         if (targetState != currentState)
         {
             Logger::GetLogger()->ToNtTable(m_nt, string("Changing climber State"), targetState);
             m_prevState = currentState;
-            SetCurrentState(targetState, true);
+            SetCurrentState(targetState, true, m_transitions.GetLastRow());
         }
     }
 }
@@ -254,4 +188,47 @@ bool ClimberStateMgr::CheckForManualInput()
     foundInput = controller != nullptr && !foundInput ? abs(controller->GetAxisValue(TeleopControl::CLIMBER_MAN_ROTATE)) > 0.05 : foundInput;  //0.05 should remove any unintentional joystick input
 
     return foundInput;
-}
\ No newline at end of file
+}
+
+MechanismSequence ClimberStateMgr::AutoClimb()
+{
+    // each step waits for the arms to reach their targets and then for the robot to stop swinging 
+    // (if the state has a robot pitch);  a step that times out stops the climb where it is, so the
+    // driver can take over
+    constexpr CLIMBER_STATE steps[] = 
+    {
+        CLIMBER_STATE::CLIMB_MID_BAR,               // pull up to the mid bar
+        CLIMBER_STATE::PREPARE_EXTEND_MID_BAR,      // hook onto the mid bar
+        CLIMBER_STATE::EXTEND_MID_BAR,              // lift off the mid bar
+        CLIMBER_STATE::ROTATE_MID_BAR,              // rotate off the mid bar
+        CLIMBER_STATE::REACH_HIGH_BAR,              // reach the high bar
+        CLIMBER_STATE::CLIMB_HIGH_BAR,              // pull up to the high bar
+        CLIMBER_STATE::PREPARE_EXTEND_HIGH_BAR,     // rotate before extending
+        CLIMBER_STATE::EXTEND_HIGH_BAR,             // extend and rotate off the high bar
+        CLIMBER_STATE::CLIMB_TRAVERSAL_BAR          // pull up to the traversal bar
+    };
+    constexpr units::second_t stepTimeout(3.0);
+    constexpr units::second_t settleTimeout(2.0);
+    constexpr units::second_t pause(0.5);
+    constexpr double pitchTolerance = 2.0;
+
+    for (auto step : steps)
+    {
+        m_prevState = static_cast<CLIMBER_STATE>(GetCurrentState());
+        SetCurrentState(step, true, StateTrace::TRIGGER::SEQUENCE);
+
+        auto state = dynamic_cast<ClimberState*>(GetCurrentStatePtr());
+        if (!co_await MechanismSequence::AtTarget(state, stepTimeout))
+        {
+            Logger::GetLogger()->LogError(string("ClimberStateMgr::AutoClimb"), string("step timed out: ") + to_string(step));
+            co_return;
+        }
+        if (state != nullptr && state->GetRobotPitch() != 0.0 && 
+            !co_await MechanismSequence::PitchWithin(state->GetRobotPitch(), pitchTolerance, settleTimeout))
+        {
+            Logger::GetLogger()->LogError(string("ClimberStateMgr::AutoClimb"), string("robot didn't settle: ") + to_string(step));
+            co_return;
+        }
+        co_await MechanismSequence::Delay(pause);
+    }
+}
@@ -28,8 +28,10 @@
 
 // Team 302 includes
 #include <states/IState.h>
+#include <states/MechanismSequence.h>
 #include <states/StateMgr.h>
 #include <states/StateStruc.h>
+#include <states/StateTransitionTable.h>
 #include <subsys/Climber.h>
 
 // Third Party Includes
@@ -83,14 +85,26 @@ class ClimberStateMgr : public StateMgr
         /// @return Bool - if there is input or not
         bool CheckForManualInput();
 
+        /// @brief  The automated climb from the mid bar to the traversal bar
+        MechanismSequence AutoClimb();
+
+        /// @brief  input bits for the transition table
+        enum CLIMBER_INPUT
+        {
+            CLIMB_MODE          = 1 << 0,
+            MANUAL_INPUT        = 1 << 1,
+            INITIAL_REACH_INPUT = 1 << 2,
+            AUTO_CLIMB_INPUT    = 1 << 3
+        };
+
         Climber*                                m_climber;
         std::shared_ptr<nt::NetworkTable>       m_nt;     
-        bool                                    m_wasAutoClimb;
         CLIMBER_STATE                           m_prevState;
         bool                                    m_hasZeroed;
-        CLIMBER_STATE                           m_currentAutoState;
 
-        frc::Timer                              m_autoTimer;
+        StateTransitionTable                    m_transitions;
+        MechanismSequence                       m_autoClimb;
+        bool                                    m_autoClimbStarted;     // until climb mode is released
 
 
 		static ClimberStateMgr*	m_instance;
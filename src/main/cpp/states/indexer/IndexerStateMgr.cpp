@@ -21,6 +21,7 @@
 // FRC includes
 
 // Team 302 includes
+#include <controllers/MechanismTargetData.h>
 #include <gamepad/TeleopControl.h>
 #include <states/indexer/IndexerStateMgr.h>
 #include <states/Intake/IntakeStateMgr.h>
@@ -54,7 +55,7 @@ IndexerStateMgr* IndexerStateMgr::GetInstance()
 
 
 /// @brief    initialize the state manager, parse the configuration file and create the states.
-IndexerStateMgr::IndexerStateMgr() : StateMgr(),
+IndexerStateMgr::IndexerStateMgr() : StaticStateMgr(),
                                      m_indexer(MechanismFactory::GetMechanismFactory()->GetIndexer()),
                                      m_shooterStateMgr(ShooterStateMgr::GetInstance()),
                                      m_prevIndexState(INDEXER_STATE::OFF),
@@ -73,6 +74,20 @@ IndexerStateMgr::IndexerStateMgr() : StateMgr(),
     Init(MechanismFactory::GetMechanismFactory()->GetIndexer(), stateMap);
 }   
 
+IState* IndexerStateMgr::CreateState
+(
+    const StateStruc&               struc,
+    const MechanismTargetData*      targetData
+)
+{
+    return m_states.Emplace<IndexerState>(struc.id, 
+                                          m_indexer, 
+                                          targetData->GetController(), 
+                                          targetData->GetController2(), 
+                                          targetData->GetTarget(), 
+                                          targetData->GetSecondTarget());
+}
+
 
 /// @brief  run the current state
 /// @return void
@@ -141,7 +156,7 @@ void IndexerStateMgr::CheckForStateTransition()
         }
         if(targetState != currentState)
         {
-            SetCurrentState(targetState,true);
+            SetCurrentState(targetState, true, StateTrace::TRIGGER::INPUT);
         }
     }    
 	
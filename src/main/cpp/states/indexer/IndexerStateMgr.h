@@ -22,6 +22,8 @@
 
 // Team 302 includes
 #include <states/StateMgr.h>
+#include <states/StaticStateMgr.h>
+#include <states/indexer/IndexerState.h>
 #include <states/StateStruc.h>
 #include <states/shooter/ShooterStateMgr.h>
 #include <subsys/Indexer.h>
@@ -31,7 +33,7 @@
 
 // Third Party Includes
 
-class IndexerStateMgr : public StateMgr
+class IndexerStateMgr final : public StaticStateMgr<IndexerStateMgr, IndexerState>
 {
     public:
         /// @enum the various states of the Intake
@@ -70,6 +72,12 @@ class IndexerStateMgr : public StateMgr
         bool IsBallPresent() const;
 
     protected:
+        IState* CreateState
+        (
+            const StateStruc&               struc,
+            const MechanismTargetData*      targetData
+        ) override;
+
         const StateStruc  m_offState = {INDEXER_STATE::OFF, StateType::INDEXER, true};
         const StateStruc  m_indexLeftState = {INDEXER_STATE::INDEX_LEFT, StateType::INDEXER, false};
         const StateStruc  m_indexRightState = {INDEXER_STATE::INDEX_RIGHT, StateType::INDEXER, false};
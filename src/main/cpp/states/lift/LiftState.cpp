@@ -21,6 +21,8 @@
 #include <subsys/interfaces/IMech1IndMotor.h>
 #include <subsys/Lift.h>
 
+using namespace std;
+
 LiftState::LiftState
 (
     Lift*      lift,
@@ -29,7 +31,30 @@ LiftState::LiftState
 ) : Mech1MotorState (lift, 
                      control,
                      target),
-    m_lift(lift)
+    m_lift(lift),
+    m_profile()
+{
+    if ( lift != nullptr && control != nullptr && control->GetMode() == ControlModes::CONTROL_TYPE::MOTION_PROFILE )
+    {
+        m_profile = make_unique<DragonMotionProfile>(lift->GetMotor(), lift->GetNetworkTableName());
+    }
+}
+
+void LiftState::Init()
+{
+    if ( m_profile.get() != nullptr )
+    {
+        m_profile.get()->Start( m_lift->GetPosition(), GetTarget(), GetControlData() );
+    }
+    Mech1MotorState::Init();
+}
+
+void LiftState::Run()
 {
+    Mech1MotorState::Run();
+    if ( m_profile.get() != nullptr )
+    {
+        m_profile.get()->Update();
+    }
 }
 
@@ -14,6 +14,12 @@
 //====================================================================================================================================================
 
 #pragma once
+
+// C++ Includes
+#include <memory>
+
+// Team 302 Includes
+#include <controllers/DragonMotionProfile.h>
 #include <states/Mech1MotorState.h>
 
 class ControlData;
@@ -32,6 +38,10 @@ class LiftState : public Mech1MotorState
         );
         ~LiftState() = default;
 
+        void Init() override;
+        void Run() override;
+
     private:
-        Lift*     m_lift;
+        Lift*                                   m_lift;
+        std::unique_ptr<DragonMotionProfile>    m_profile;
 };
\ No newline at end of file
@@ -22,6 +22,7 @@
 // Team 302 includes
 #include <states/lift/LiftStateMgr.h>
 #include <states/lift/LiftState.h>
+#include <controllers/MechanismTargetData.h>
 #include <states/StateStruc.h>
 #include <states/StateMgr.h>
 
@@ -52,7 +53,7 @@ LiftStateMgr* LiftStateMgr::GetInstance()
 }
 
 /// @brief    initialize the state manager, parse the configuration file and create the states.
-LiftStateMgr::LiftStateMgr() : StateMgr(),
+LiftStateMgr::LiftStateMgr() : StaticStateMgr(),
                                 m_shooterStateMgr(ShooterStateMgr::GetInstance()),
                                 m_shooter(MechanismFactory::GetMechanismFactory()->GetShooter()),
                                 m_lift(MechanismFactory::GetMechanismFactory()->GetLift())
@@ -65,6 +66,15 @@ LiftStateMgr::LiftStateMgr() : StateMgr(),
 }   
 
 
+IState* LiftStateMgr::CreateState
+(
+    const StateStruc&               struc,
+    const MechanismTargetData*      targetData
+)
+{
+    return m_states.Emplace<LiftState>(struc.id, m_lift, targetData->GetController(), targetData->GetTarget());
+}
+
 /// @brief  run the current state
 /// @return void
 void LiftStateMgr::CheckForStateTransition()
@@ -76,9 +86,9 @@ void LiftStateMgr::CheckForStateTransition()
 
         if (m_shooterStateMgr != nullptr)
         {
-            bool isAtSpeed = m_shooterStateMgr->AtTarget();
+            bool isReady = m_shooterStateMgr->IsReadyToFeed();
 
-            if (isAtSpeed)
+            if (isReady)
             {
                 auto isShooting = m_shooterStateMgr->IsShooting();
                 if (isShooting)
@@ -103,7 +113,7 @@ void LiftStateMgr::CheckForStateTransition()
     
         if (targetState != currentState)
         {
-            SetCurrentState(targetState, true);
+            SetCurrentState(targetState, true, StateTrace::TRIGGER::INPUT);
         }
     }
 }
@@ -24,6 +24,8 @@
 #include <states/StateStruc.h>
 #include <states/shooter/ShooterStateMgr.h>
 #include <states/StateMgr.h>
+#include <states/StaticStateMgr.h>
+#include <states/lift/LiftState.h>
 
 #include <subsys/Shooter.h>
 #include <subsys/Lift.h>
@@ -31,7 +33,7 @@
 
 // Third Party Includes
 
-class LiftStateMgr : public StateMgr
+class LiftStateMgr final : public StaticStateMgr<LiftStateMgr, LiftState>
 {
     public:
         /// @enum the various states of the Lift
@@ -49,6 +51,12 @@ class LiftStateMgr : public StateMgr
         void CheckForStateTransition() override;
 
     protected:
+        IState* CreateState
+        (
+            const StateStruc&               struc,
+            const MechanismTargetData*      targetData
+        ) override;
+
         const StateStruc  m_offState = {LIFT_STATE::OFF, StateType::LIFT, true};
         const StateStruc  m_liftState = {LIFT_STATE::LIFT, StateType::LIFT, false};
         const StateStruc  m_lowerState = {LIFT_STATE::LOWER, StateType::LIFT, false};
@@ -0,0 +1,250 @@
+
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302 
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF 
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, 
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE 
+// OR OTHER DEALINGS IN THE SOFTWARE.
+
+// C++ Includes
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <string>
+
+// FRC includes
+#include <frc/RobotController.h>
+#include <frc/Timer.h>
+
+// Team 302 includes
+#include <hw/MotorData.h>
+#include <hw/interfaces/IDragonMotorController.h>
+#include <states/shooter/ShooterReadiness.h>
+#include <subsys/Shooter.h>
+#include <utils/Logger.h>
+
+// Third Party Includes
+
+using namespace std;
+
+namespace
+{
+    constexpr double TWO_PI = 2.0 * 3.14159265358979323846;
+
+    constexpr double SLOPE_FILTER = 0.5;        // weight of the newest velocity slope sample
+    constexpr double MOI_FILTER = 0.1;          // weight of the newest inertia fit
+    constexpr double MIN_FIT_SLOPE = 5.0;       // rev/s^2;  below this the slope is mostly noise
+    constexpr double SATURATED_OUTPUT = 0.95;   // applied output that counts as full scale
+    constexpr double SIM_STEP = 0.005;          // seconds
+    constexpr double SIM_HORIZON = 2.0;         // seconds
+    constexpr double MAX_LOOP_GAP = 0.1;        // seconds;  a longer gap restarts the slope
+    constexpr double ERROR_FILTER = 0.25;       // weight of the newest arrival error
+    constexpr int    MIN_ARRIVALS = 5;          // arrivals before the prediction can be trusted
+    constexpr double MAX_ARRIVAL_ERROR = 0.04;  // seconds of recent arrival error the prediction is trusted with
+}
+
+ShooterReadiness::ShooterReadiness
+(
+    Shooter*                shooter
+) : m_shooter(shooter),
+    m_ntName(shooter != nullptr ? shooter->GetNetworkTableName() : string("shooter")),
+    m_primary(),
+    m_secondary(),
+    m_feedLeadTime(0.0),
+    m_lastTime(-1.0),
+    m_timeToTarget(NEVER),
+    m_predictedArrival(-1.0),
+    m_arrived(false),
+    m_arrivals(0),
+    m_totalAbsError(0.0),
+    m_recentAbsError(0.0),
+    m_trusted(false)
+{
+    if ( m_shooter != nullptr )
+    {
+        m_primary.motor = m_shooter->GetPrimaryMotor();
+        m_secondary.motor = m_shooter->GetSecondaryMotor();
+    }
+}
+
+void ShooterReadiness::Update()
+{
+    if ( m_shooter == nullptr )
+    {
+        return;
+    }
+
+    auto now = frc::Timer::GetFPGATimestamp().to<double>();
+    auto dt = m_lastTime < 0.0 ? 0.0 : now - m_lastTime;
+    m_lastTime = now;
+
+    auto targetChanged = abs(m_shooter->GetPrimaryTarget() - m_primary.target) > TOLERANCE ||
+                         abs(m_shooter->GetSecondaryTarget() - m_secondary.target) > TOLERANCE;
+    if ( targetChanged )
+    {
+        m_predictedArrival = -1.0;
+        m_arrived = false;
+    }
+
+    auto voltage = frc::RobotController::GetBatteryVoltage().to<double>();
+    UpdateWheel(m_primary, m_shooter->GetPrimaryTarget(), dt, voltage);
+    UpdateWheel(m_secondary, m_shooter->GetSecondaryTarget(), dt, voltage);
+
+    m_timeToTarget = max(TimeToTarget(m_primary, voltage), TimeToTarget(m_secondary, voltage));
+    TrackArrival(now);
+
+    Logger::GetLogger()->ToNtTable(m_ntName, string("Readiness - Time To Target"), m_timeToTarget);
+}
+
+void ShooterReadiness::Reset()
+{
+    m_lastTime = -1.0;
+    m_timeToTarget = NEVER;
+    m_predictedArrival = -1.0;
+    m_arrived = false;
+    m_primary.hasSpeed = false;
+    m_primary.slope = 0.0;
+    m_secondary.hasSpeed = false;
+    m_secondary.slope = 0.0;
+}
+
+void ShooterReadiness::SetFeedLeadTime
+(
+    double                  seconds
+)
+{
+    m_feedLeadTime = max(seconds, 0.0);
+}
+
+void ShooterReadiness::UpdateWheel
+(
+    Wheel&                  wheel,
+    double                  target,
+    double                  dt,
+    double                  voltage
+)
+{
+    wheel.target = target;
+    if ( wheel.motor.get() == nullptr )
+    {
+        return;
+    }
+
+    auto speed = wheel.motor.get()->GetRPS();
+    wheel.saturated = abs(wheel.motor.get()->GetMotorOutputPercent()) >= SATURATED_OUTPUT;
+    if ( wheel.hasSpeed && dt > 0.0 && dt < MAX_LOOP_GAP )
+    {
+        auto slope = (speed - wheel.speed) / dt;
+        wheel.slope += SLOPE_FILTER * (slope - wheel.slope);
+
+        // while the controller is saturated the motor is at the battery voltage, so the measured
+        // acceleration is the motor model's acceleration at that voltage and gives the inertia
+        // (far from the target alone doesn't mean saturated: the gains may not ask for full output)
+        auto error = target - speed;
+        if ( wheel.saturated && error > 3.0 * TOLERANCE && wheel.slope > MIN_FIT_SLOPE )
+        {
+            auto type = wheel.motor.get()->GetMotorType();
+            auto reduction = wheel.motor.get()->GetGearRatio();
+            auto unitAccel = MotorData::GetAcceleration(type, speed * TWO_PI, voltage, 1.0, reduction);
+            if ( unitAccel > 0.0 )
+            {
+                auto moi = unitAccel / (wheel.slope * TWO_PI);
+                wheel.moi = wheel.moi > 0.0 ? wheel.moi + MOI_FILTER * (moi - wheel.moi) : moi;
+            }
+        }
+    }
+    else
+    {
+        wheel.slope = 0.0;
+    }
+    wheel.speed = speed;
+    wheel.hasSpeed = true;
+}
+
+double ShooterReadiness::TimeToTarget
+(
+    const Wheel&            wheel,
+    double                  voltage
+) const
+{
+    auto error = wheel.target - wheel.speed;
+    if ( abs(error) < TOLERANCE )
+    {
+        return 0.0;
+    }
+
+    // spinning up at full output with a fit model:  step the model until it is within tolerance.  Once
+    // the controller backs off near the target the model (at the battery voltage) would be too early, 
+    // and the measured slope follows the closed loop approach instead.
+    if ( error > 0.0 && wheel.saturated && wheel.moi > 0.0 && wheel.motor.get() != nullptr )
+    {
+        auto type = wheel.motor.get()->GetMotorType();
+        auto reduction = wheel.motor.get()->GetGearRatio();
+        auto omega = wheel.speed * TWO_PI;
+        auto goal = (wheel.target - TOLERANCE) * TWO_PI;
+        for ( auto t=SIM_STEP; t<=SIM_HORIZON; t+=SIM_STEP )
+        {
+            auto next = MotorData::SimulateSpeed(type, omega, voltage, wheel.moi, reduction, SIM_STEP);
+            if ( next >= goal )
+            {
+                return t;
+            }
+            if ( next <= omega )
+            {
+                break;      // the model can't reach the target at this voltage
+            }
+            omega = next;
+        }
+    }
+
+    // otherwise assume the current slope holds
+    auto remaining = abs(error) - TOLERANCE;
+    if ( error * wheel.slope > 0.0 )
+    {
+        return remaining / abs(wheel.slope);
+    }
+    return NEVER;
+}
+
+void ShooterReadiness::TrackArrival
+(
+    double                  now
+)
+{
+    if ( m_arrived )
+    {
+        return;
+    }
+
+    if ( m_predictedArrival < 0.0 && IsReady() )
+    {
+        m_predictedArrival = now + m_timeToTarget;
+    }
+
+    if ( m_timeToTarget <= 0.0 )
+    {
+        m_arrived = true;
+        if ( m_predictedArrival >= 0.0 )
+        {
+            auto error = now - m_predictedArrival;     // > 0.0 means the wheels were late
+            ++m_arrivals;
+            m_totalAbsError += abs(error);
+            m_recentAbsError = m_arrivals == 1 ? abs(error) : m_recentAbsError + ERROR_FILTER * (abs(error) - m_recentAbsError);
+            m_trusted = m_arrivals >= MIN_ARRIVALS && m_recentAbsError <= MAX_ARRIVAL_ERROR;
+
+            auto logger = Logger::GetLogger();
+            logger->ToNtTable(m_ntName, string("Readiness - Arrival Error"), error);
+            logger->ToNtTable(m_ntName, string("Readiness - Mean Abs Arrival Error"), m_totalAbsError / m_arrivals);
+            logger->ToNtTable(m_ntName, string("Readiness - Recent Abs Arrival Error"), m_recentAbsError);
+            logger->ToNtTable(m_ntName, string("Readiness - Arrivals"), m_arrivals);
+            logger->ToNtTable(m_ntName, string("Readiness - Trusted"), m_trusted ? string("True") : string("False"));
+        }
+    }
+}
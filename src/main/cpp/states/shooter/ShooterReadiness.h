@@ -0,0 +1,132 @@
+
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302 
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF 
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, 
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE 
+// OR OTHER DEALINGS IN THE SOFTWARE.
+
+#pragma once
+
+// C++ Includes
+#include <memory>
+#include <string>
+
+// FRC includes
+
+// Team 302 includes
+#include <hw/interfaces/IDragonMotorController.h>
+
+// Third Party Includes
+
+class Shooter;
+
+/// @class ShooterReadiness
+/// @brief Predicts when the flywheels will be within tolerance of their targets, so the lift can start
+///        feeding a ball early enough that it reaches the wheels just as they arrive instead of 
+///        waiting for the wheels and then for the ball.  Each wheel's time to target comes from the
+///        MotorData DC motor model stepped forward at the battery voltage.  The model's inertia is
+///        fit online from the measured velocity slope while the controller is saturated (applied output
+///        at full scale), so the motor really is at the battery voltage.  Until it is fit, once the 
+///        controller comes out of saturation near the target, or when the wheel is slowing down, the 
+///        time comes from the velocity slope alone.  The feed lead time comes from the shooter's state
+///        file (<readiness feedLeadTime="..."/>).
+///
+///        Once per target it records when it first said the wheels would arrive and when they did, and
+///        publishes the arrival error to the shooter network table.  The prediction is only trusted 
+///        (IsTrusted) after several arrivals with a small recent error;  until then the shooter feeds
+///        when the wheels are at target.
+class ShooterReadiness
+{
+    public:
+        /// @brief  Speed error (revolutions per second) that counts as at target;  same as Mech2MotorState
+        static constexpr double TOLERANCE = 1.0;
+
+        /// @brief  Returned when the wheels aren't getting closer to their targets
+        static constexpr double NEVER = 1.0e6;
+
+        ShooterReadiness
+        (
+            Shooter*                shooter
+        );
+        ShooterReadiness() = delete;
+        ~ShooterReadiness() = default;
+
+        /// @brief  Read the wheel speeds and targets and update the prediction;  call once per loop
+        ///         while the shooter is under velocity control
+        void Update();
+
+        /// @brief  Forget the slopes and the pending arrival (the shooter isn't under velocity control)
+        void Reset();
+
+        /// @brief  Set the seconds the lift takes to carry a ball into the wheels
+        void SetFeedLeadTime
+        (
+            double                  seconds
+        );
+
+        /// @brief  Will both wheels be at target by the time a ball fed now reaches them
+        /// @return bool - true if the ball can be fed now
+        inline bool IsReady() const { return m_timeToTarget <= m_feedLeadTime; }
+
+        /// @brief  Have the recent predictions been accurate enough to feed early on them
+        inline bool IsTrusted() const { return m_trusted; }
+
+        /// @brief  Predicted seconds until both wheels are at target (0.0 if they are, NEVER if they aren't
+        ///         getting closer)
+        inline double GetTimeToTarget() const { return m_timeToTarget; }
+
+    private:
+        /// @brief  one flywheel
+        struct Wheel
+        {
+            std::shared_ptr<IDragonMotorController>     motor;
+            double                                      target = 0.0;   // revolutions per second
+            double                                      speed = 0.0;    // revolutions per second
+            double                                      slope = 0.0;    // revolutions per second squared
+            double                                      moi = 0.0;      // kg*m^2 at the output (0.0 until fit)
+            bool                                        hasSpeed = false;
+            bool                                        saturated = false;  // applied output at full scale
+        };
+
+        void UpdateWheel
+        (
+            Wheel&                  wheel,
+            double                  target,
+            double                  dt,
+            double                  voltage
+        );
+
+        double TimeToTarget
+        (
+            const Wheel&            wheel,
+            double                  voltage
+        ) const;
+
+        void TrackArrival
+        (
+            double                  now
+        );
+
+        Shooter*                    m_shooter;
+        std::string                 m_ntName;
+        Wheel                       m_primary;
+        Wheel                       m_secondary;
+        double                      m_feedLeadTime;         // seconds
+        double                      m_lastTime;
+        double                      m_timeToTarget;
+
+        double                      m_predictedArrival;     // FPGA seconds;  < 0.0 until predicted
+        bool                        m_arrived;
+        int                         m_arrivals;
+        double                      m_totalAbsError;
+        double                      m_recentAbsError;       // filtered seconds
+        bool                        m_trusted;
+};
@@ -20,6 +20,7 @@
 // FRC includes
 
 // Team 302 includes
+#include <controllers/ShotMap.h>
 #include <hw/DragonLimelight.h>
 #include <hw/factories/LimelightFactory.h>
 #include <states/IState.h>
@@ -40,13 +41,15 @@ ShooterStateAutoHigh::ShooterStateAutoHigh
     double                          primaryTarget,
     double                          secondaryTarget,
     array<double,3>                 primaryFunctionCoeff,
-    array<double,3>                 secondaryFunctionCoeff
+    array<double,3>                 secondaryFunctionCoeff,
+    const ShotMap*                  shotMap
 ) : ShooterState(control, control2, primaryTarget, secondaryTarget), 
     m_dragonLimeLight(LimelightFactory::GetLimelightFactory()->GetLimelight()), 
     m_shooterTarget(primaryTarget),
     m_shooterTarget2(secondaryTarget),
     m_primaryFunctionCoeff(primaryFunctionCoeff),
-    m_secondaryFunctionCoeff(secondaryFunctionCoeff)
+    m_secondaryFunctionCoeff(secondaryFunctionCoeff),
+    m_shotMap(shotMap)
 {
 }
 
@@ -55,69 +58,49 @@ void ShooterStateAutoHigh::Init()
     auto shooter = GetShooter();    
     if (shooter != nullptr)
     {       
-        auto shooterTarget = GetPrimaryTarget();
-        auto shooterTarget2 = GetSecondaryTarget();
-
         double inches = 90.0;
         if (m_dragonLimeLight != nullptr)
         {
             auto distance = m_dragonLimeLight->EstimateTargetDistance();
             inches = distance.to<double>();
         }
-       
-        shooterTarget = 0.0019*inches*inches - 0.2762*inches + 52.784; //y = 0.0019x2 - 0.2762x + 54.784
-        shooterTarget2 = 0.0026*inches*inches - 0.4067*inches + 51.411; //y = 0.0026x2 - 0.4067x + 51.411
+        
+        shooter->SetControlConstants(0, GetPrimaryControlData());
+        shooter->SetSecondaryControlConstants(0, GetSecondaryControlData());
+        Retarget(inches);
+    }
+}
 
+void ShooterStateAutoHigh::Run()
+{
+    // keep the last targets if the goal is out of view
+    if (m_dragonLimeLight != nullptr && m_dragonLimeLight->HasTarget())
+    {
+        Retarget(m_dragonLimeLight->EstimateTargetDistance().to<double>());
+    }
+    ShooterState::Run();
+}
 
-       /* if (inches > 110)
+void ShooterStateAutoHigh::Retarget
+(
+    double                          inches
+)
+{
+    auto shooter = GetShooter();    
+    if (shooter != nullptr)
+    {
+        if (m_shotMap != nullptr && !m_shotMap->IsEmpty())
         {
-            shooterTarget = 54;
-            shooterTarget2 = 0.65;
+            auto shot = m_shotMap->Lookup(inches);
+            m_shooterTarget = shot.top;
+            m_shooterTarget2 = shot.bottom;
+            Logger::GetLogger()->ToNtTable(shooter->GetNetworkTableName(), string("Shot Map - Hood"), shot.hood);
         }
         else
         {
-            shooterTarget = 46.75; //46
-            shooterTarget2 = 0.35
-            
-        }*/
-        /**
-        auto shooterTarget = m_primaryFunctionCoeff[0]*inches*inches + 
-                             m_primaryFunctionCoeff[1]*inches + 
-                             m_primaryFunctionCoeff[2] +
-                             GetPrimaryTarget() + 
-                             indexerOffset;
-        auto shooterTarget2 = m_secondaryFunctionCoeff[0]*inches*inches + 
-                              m_secondaryFunctionCoeff[1]*inches + 
-                              m_secondaryFunctionCoeff[2] +
-                              GetSecondaryTarget() +
-                              indexerOffset;
-        **/
-       /*
-        auto logger = Logger::GetLogger();
-        auto nt = shooter->GetNetworkTableName();
-        auto cd = GetPrimaryControlData();
-        auto cd2 = GetSecondaryControlData();
-
-        logger->ToNtTable(nt, string("control data Mode1"), cd->GetMode());
-        logger->ToNtTable(nt, string("control data Identifier1"), cd->GetIdentifier());
-        logger->ToNtTable(nt, string("control data p1"), cd->GetP());
-        logger->ToNtTable(nt, string("control data i1"), cd->GetI());
-        logger->ToNtTable(nt, string("control data d1"), cd->GetD());
-        logger->ToNtTable(nt, string("control data f1"), cd->GetF());
-        logger->ToNtTable(nt, string("target 1"), shooterTarget);
-
-        logger->ToNtTable(nt, string("control data Mode2"), cd2->GetMode());
-        logger->ToNtTable(nt, string("control data Identifier2"), cd2->GetIdentifier());
-        logger->ToNtTable(nt, string("control data p2"), cd2->GetP());
-        logger->ToNtTable(nt, string("control data i2"), cd2->GetI());
-        logger->ToNtTable(nt, string("control data d2"), cd2->GetD());
-        logger->ToNtTable(nt, string("control data f2"), cd2->GetF());
-        logger->ToNtTable(nt, string("target 2"), shooterTarget2);
-        */
-        
-        shooter->SetControlConstants(0, GetPrimaryControlData());
-        shooter->SetSecondaryControlConstants(0, GetSecondaryControlData());
-        shooter->UpdateTargets(shooterTarget, shooterTarget2);
-
+            m_shooterTarget = 0.0019*inches*inches - 0.2762*inches + 52.784; //y = 0.0019x2 - 0.2762x + 54.784
+            m_shooterTarget2 = 0.0026*inches*inches - 0.4067*inches + 51.411; //y = 0.0026x2 - 0.4067x + 51.411
+        }
+        shooter->UpdateTargets(m_shooterTarget, m_shooterTarget2);
     }
 }
@@ -16,6 +16,7 @@
 
 #include <array>
 
+#include <controllers/ShotMap.h>
 #include <hw/DragonLimelight.h>
 #include <states/shooter/ShooterState.h>
 #include <subsys/Shooter.h>
@@ -32,16 +33,28 @@ class ShooterStateAutoHigh : public ShooterState
             double                          primaryTarget,
             double                          secondaryTarget,
             std::array<double,3>            primaryFunctionCoeff,
-            std::array<double,3>            secondaryFunctionCoeff
+            std::array<double,3>            secondaryFunctionCoeff,
+            const ShotMap*                  shotMap = nullptr
         );
         ~ShooterStateAutoHigh() = default;
         void Init() override;
+
+        /// @brief  re-target the wheels for the current distance, then run
+        void Run() override;
     
     private:
+        /// @brief  set the wheel targets for a distance from the shot map (or the fitted curves
+        ///         if there is no shot map)
+        void Retarget
+        (
+            double                          inches
+        );
+
         DragonLimelight*        m_dragonLimeLight;
         double                  m_shooterTarget;
         double                  m_shooterTarget2;
         std::array<double,3>    m_primaryFunctionCoeff;
         std::array<double,3>    m_secondaryFunctionCoeff;
+        const ShotMap*          m_shotMap;
         
 };
\ No newline at end of file
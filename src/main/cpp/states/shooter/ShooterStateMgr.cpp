@@ -12,8 +12,11 @@
 /// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
 /// OR OTHER DEALINGS IN THE SOFTWARE.
 //====================================================================================================================================================
+#include <iomanip>
 #include <map>
 #include <memory>
+#include <sstream>
+#include <string>
 #include <vector>
 
 // FRC includes
@@ -24,11 +27,16 @@
 // Team 302 includes
 #include <states/IState.h>
 #include <states/shooter/ShooterStateMgr.h>
+#include <xmlmechdata/StateDataCache.h>
 #include <xmlmechdata/StateDataDefn.h>
+#include <controllers/ControlData.h>
+#include <controllers/ControlModes.h>
 #include <controllers/MechanismTargetData.h>
 #include <utils/Logger.h>
 #include <gamepad/TeleopControl.h>
 #include <states/shooter/ShooterState.h>
+#include <states/shooter/ShooterStateAutoHigh.h>
+#include <states/shooter/ShooterStateManual.h>
 #include <states/StateMgr.h>
 #include <states/StateStruc.h>
 #include <subsys/MechanismFactory.h>
@@ -61,10 +69,23 @@ ShooterStateMgr* ShooterStateMgr::GetInstance()
 
 
 /// @brief    initialize the state manager, parse the configuration file and create the states.
-ShooterStateMgr::ShooterStateMgr() : StateMgr(),
+ShooterStateMgr::ShooterStateMgr() : StaticStateMgr(),
+                                     m_dragonLimeLight(nullptr),
                                      m_shooter(MechanismFactory::GetMechanismFactory()->GetShooter()),
                                      m_nt(),
-                                     m_buttonTriggerStateChange(false)
+                                     // buttons in priority order;  shooting waits until the limelight is lined up and 
+                                     // releasing the buttons goes back to preparing to shoot
+                                     m_transitions({
+                                        {StateTransitionTable::ALL_STATES, SHOOT_HIGH_PRESSED, SHOOT_HIGH_PRESSED, 0, [this]() { return IsAligned(); }, SHOOTER_STATE::AUTO_SHOOT_HIGH_GOAL_FAR},
+                                        {StateTransitionTable::ALL_STATES, SHOOT_LOW_PRESSED, SHOOT_LOW_PRESSED, 0, [this]() { return IsAligned(); }, SHOOTER_STATE::SHOOT_LOW_GOAL},
+                                        {StateTransitionTable::ALL_STATES, PREPARE_PRESSED, PREPARE_PRESSED, 0, nullptr, SHOOTER_STATE::PREPARE_TO_SHOOT},
+                                        {StateTransitionTable::ALL_STATES, MANUAL_SHOOT_PRESSED, MANUAL_SHOOT_PRESSED, 0, nullptr, SHOOTER_STATE::SHOOT_MANUAL},
+                                        {StateTransitionTable::ALL_STATES, SHOOTER_OFF_PRESSED, SHOOTER_OFF_PRESSED, 0, nullptr, SHOOTER_STATE::OFF},
+                                        {StateTransitionTable::ALL_STATES & ~StateTransitionTable::StateBit(SHOOTER_STATE::OFF), ANY_PRESSED, 0, ANY_PRESSED, nullptr, SHOOTER_STATE::PREPARE_TO_SHOOT}
+                                     }),
+                                     m_readiness(MechanismFactory::GetMechanismFactory()->GetShooter()),
+                                     m_shotMap(),
+                                     m_velocityStates()
 {
     map<string, StateStruc> stateMap;
     stateMap[m_shooterOffXmlString] = m_offState;
@@ -76,6 +97,16 @@ ShooterStateMgr::ShooterStateMgr() : StateMgr(),
 
     m_dragonLimeLight = LimelightFactory::GetLimelightFactory()->GetLimelight();
     
+    // the shot map has to be loaded before the states are created
+    if (m_shooter != nullptr)
+    {
+        auto stateData = StateDataCache::GetInstance()->GetStateData(m_shooter->GetControlFileName());
+        if (stateData != nullptr)
+        {
+            m_shotMap.SetPoints(stateData->shotMap);
+            m_readiness.SetFeedLeadTime(stateData->feedLeadTime);
+        }
+    }
 
     Init(m_shooter, stateMap);
     if (m_shooter != nullptr)
@@ -87,13 +118,67 @@ ShooterStateMgr::ShooterStateMgr() : StateMgr(),
     {
         m_nt = nt::NetworkTableInstance::GetDefault().GetTable("shooter");
     }
+
+    m_nt.get()->PutBoolean(m_addShotNtString, false);
+    m_nt.get()->SetDefaultNumber(m_shotTopNtString, 0.0);
+    m_nt.get()->SetDefaultNumber(m_shotBottomNtString, 0.0);
+    m_nt.get()->SetDefaultNumber(m_shotHoodNtString, 0.0);
+    PublishShotMap();
 }   
 
 
+IState* ShooterStateMgr::CreateState
+(
+    const StateStruc&               struc,
+    const MechanismTargetData*      targetData
+)
+{
+    if ( struc.id >= 0 )
+    {
+        if ( static_cast<size_t>(struc.id) >= m_velocityStates.size() )
+        {
+            m_velocityStates.resize(struc.id + 1, false);
+        }
+        auto control = targetData->GetController();
+        auto control2 = targetData->GetController2();
+        m_velocityStates[struc.id] = struc.type != StateType::SHOOTER_MANUAL &&
+                                     control != nullptr && control->GetMode() == ControlModes::CONTROL_TYPE::VELOCITY_RPS &&
+                                     control2 != nullptr && control2->GetMode() == ControlModes::CONTROL_TYPE::VELOCITY_RPS;
+    }
+
+    switch (struc.type)
+    {
+        case StateType::SHOOTER:
+            return m_states.Emplace<ShooterState>(struc.id, 
+                                                  targetData->GetController(), 
+                                                  targetData->GetController2(), 
+                                                  targetData->GetTarget(), 
+                                                  targetData->GetSecondTarget());
+
+        case StateType::SHOOTER_MANUAL:
+            return m_states.Emplace<ShooterStateManual>(struc.id);
+
+        case StateType::SHOOTER_AUTO:
+            return m_states.Emplace<ShooterStateAutoHigh>(struc.id, 
+                                                          targetData->GetController(), 
+                                                          targetData->GetController2(), 
+                                                          targetData->GetTarget(), 
+                                                          targetData->GetSecondTarget(), 
+                                                          targetData->GetFunction1Coeff(), 
+                                                          targetData->GetFunction2Coeff(),
+                                                          &m_shotMap);
+
+        default:
+            Logger::GetLogger()->LogError(string("ShooterStateMgr::CreateState"), string("unknown state"));
+            return nullptr;
+    }
+}
+
 bool ShooterStateMgr::AtTarget() const
 {
-    Logger::GetLogger()->ToNtTable(m_nt, string("At Target"), GetCurrentStatePtr()->AtTarget() ? "true" : "false");
-    return GetCurrentStatePtr()->AtTarget();
+    auto atTarget = IsCurrentStateAtTarget();
+    Logger::GetLogger()->ToNtTable(m_nt, string("At Target"), atTarget ? "true" : "false");
+    return atTarget;
 }
 
 void ShooterStateMgr::CheckForStateTransition()
@@ -106,75 +191,97 @@ void ShooterStateMgr::CheckForStateTransition()
 
     if ( m_shooter != nullptr )
     {    
+        AddShotFromDashboard();
+
         auto currentState = static_cast<SHOOTER_STATE>(GetCurrentState());
-        auto targetState = currentState;
         Logger::GetLogger()->ToNtTable(m_nt, string("current state "), currentState);
 
-        auto isShootHighSelected    = false;
-        auto isShootLowSelected     = false;
-        auto isManualShootSelected  = false;
-        auto isShooterOffSelected   = false;
-        auto isPrepareToShootSelected = false;
-
+        uint32_t inputs = 0;
         auto controller = TeleopControl::GetInstance();
         if ( controller != nullptr )
         {
-            isShootHighSelected      = controller->IsButtonPressed(TeleopControl::FUNCTION_IDENTIFIER::AUTO_SHOOT_HIGH);
-            isShootLowSelected       = controller->IsButtonPressed(TeleopControl::FUNCTION_IDENTIFIER::AUTO_SHOOT_LOW);
-            isManualShootSelected    = controller->IsButtonPressed(TeleopControl::FUNCTION_IDENTIFIER::MANUAL_SHOOT);
-            isShooterOffSelected     = controller->IsButtonPressed(TeleopControl::FUNCTION_IDENTIFIER::SHOOTER_OFF) ||
-                                       controller->IsButtonPressed(TeleopControl::FUNCTION_IDENTIFIER::ENABLE_CLIMBER);
-            isPrepareToShootSelected = controller->IsButtonPressed(TeleopControl::FUNCTION_IDENTIFIER::SHOOTER_MTR_ON);
+            inputs |= controller->IsButtonPressed(TeleopControl::FUNCTION_IDENTIFIER::AUTO_SHOOT_HIGH) ? SHOOT_HIGH_PRESSED : 0;
+            inputs |= controller->IsButtonPressed(TeleopControl::FUNCTION_IDENTIFIER::AUTO_SHOOT_LOW) ? SHOOT_LOW_PRESSED : 0;
+            inputs |= controller->IsButtonPressed(TeleopControl::FUNCTION_IDENTIFIER::MANUAL_SHOOT) ? MANUAL_SHOOT_PRESSED : 0;
+            inputs |= ( controller->IsButtonPressed(TeleopControl::FUNCTION_IDENTIFIER::SHOOTER_OFF) ||
+                        controller->IsButtonPressed(TeleopControl::FUNCTION_IDENTIFIER::ENABLE_CLIMBER) ) ? SHOOTER_OFF_PRESSED : 0;
+            inputs |= controller->IsButtonPressed(TeleopControl::FUNCTION_IDENTIFIER::SHOOTER_MTR_ON) ? PREPARE_PRESSED : 0;
         }
 
-        if (isShootHighSelected)
-        {
-            targetState = SHOOTER_STATE::AUTO_SHOOT_HIGH_GOAL_FAR;
-        }
-        else if (isShootLowSelected)
-        {
-            targetState = SHOOTER_STATE::SHOOT_LOW_GOAL;
-        }
-        else if (isPrepareToShootSelected)
-        {
-            targetState = SHOOTER_STATE::PREPARE_TO_SHOOT;
-        }
-        else if (isManualShootSelected)
+        auto targetState = static_cast<SHOOTER_STATE>(m_transitions.Evaluate(currentState, inputs));
+        if (targetState != currentState)
         {
-            targetState = SHOOTER_STATE::SHOOT_MANUAL;
+            Logger::GetLogger()->ToNtTable(m_nt, string("Changing Shooter State"), targetState);
+            SetCurrentState(targetState, true, m_transitions.GetLastRow());
         }
-        else if (isShooterOffSelected)
+
+        // predict after the transition so a new state's targets are used
+        if ( IsVelocityState(GetCurrentState()) )
         {
-            targetState = SHOOTER_STATE::OFF;
+            m_readiness.Update();
         }
-        else if (currentState != SHOOTER_STATE::OFF && m_buttonTriggerStateChange)
+        else
         {
-            targetState = SHOOTER_STATE::PREPARE_TO_SHOOT;
+            m_readiness.Reset();
         }
+    }
+}
 
-        if (m_dragonLimeLight != nullptr && (targetState == SHOOTER_STATE::AUTO_SHOOT_HIGH_GOAL_CLOSE ||
-                                             targetState == SHOOTER_STATE::AUTO_SHOOT_HIGH_GOAL_FAR ||
-                                             targetState == SHOOTER_STATE::SHOOT_LOW_GOAL))
-        {
-            if(m_dragonLimeLight->GetTargetHorizontalOffset() > 5.0_deg)
-            {
-                targetState = currentState;
-            }
-        }
+bool ShooterStateMgr::IsReadyToFeed() const
+{
+    // feeding early on the prediction waits until its arrival errors show it can be trusted
+    return IsVelocityState(GetCurrentState()) && m_readiness.IsTrusted() ? m_readiness.IsReady() : AtTarget();
+}
 
-        m_buttonTriggerStateChange = isShootHighSelected    || 
-                                     isShootLowSelected     || 
-                                     isManualShootSelected  || 
-                                     isShooterOffSelected   || 
-                                     isPrepareToShootSelected;
+void ShooterStateMgr::AddShotFromDashboard()
+{
+    auto table = m_nt.get();
+    if ( table == nullptr || !table->GetBoolean(m_addShotNtString, false) )
+    {
+        return;
+    }
+    table->PutBoolean(m_addShotNtString, false);
 
-        if (targetState != currentState)
-        {
-            Logger::GetLogger()->ToNtTable(m_nt, string("Changing Shooter State"), targetState);
-            SetCurrentState(targetState, true);
-        }
-        
+    if ( m_dragonLimeLight == nullptr || !m_dragonLimeLight->HasTarget() )
+    {
+        Logger::GetLogger()->LogError(string("ShooterStateMgr::AddShotFromDashboard"), string("no goal in view;  shot not added"));
+        return;
+    }
+
+    ShotMap::Point shot = { m_dragonLimeLight->EstimateTargetDistance().to<double>(),
+                            table->GetNumber(m_shotTopNtString, 0.0),
+                            table->GetNumber(m_shotBottomNtString, 0.0),
+                            table->GetNumber(m_shotHoodNtString, 0.0) };
+    m_shotMap.AddPoint(shot);
+    PublishShotMap();
+}
+
+void ShooterStateMgr::PublishShotMap()
+{
+    ostringstream xml;
+    xml << fixed << setprecision(2);
+    for ( auto& shot : m_shotMap.GetPoints() )
+    {
+        xml << "<shotPoint distance=\"" << shot.distance 
+            << "\" top=\"" << shot.top 
+            << "\" bottom=\"" << shot.bottom 
+            << "\" hood=\"" << shot.hood << "\"/>\n";
     }
+    Logger::GetLogger()->ToNtTable(m_nt, string("Shot Map - Points"), static_cast<double>(m_shotMap.Size()));
+    Logger::GetLogger()->ToNtTable(m_nt, string("Shot Map - XML"), xml.str());
+}
+
+bool ShooterStateMgr::IsVelocityState
+(
+    int         state
+) const
+{
+    return state >= 0 && static_cast<size_t>(state) < m_velocityStates.size() && m_velocityStates[state];
+}
+
+bool ShooterStateMgr::IsAligned() const
+{
+    return m_dragonLimeLight == nullptr || m_dragonLimeLight->GetTargetHorizontalOffset() <= 5.0_deg;
 }
 
 bool ShooterStateMgr::IsShooting() const
@@ -16,14 +16,22 @@
 #pragma once
 
 // C++ Includes
+#include <vector>
 
 // FRC includes
 #include <networktables/NetworkTable.h>
 #include <frc/Timer.h>
 
 // Team 302 includes
+#include <controllers/ShotMap.h>
 #include <states/StateMgr.h>
+#include <states/StaticStateMgr.h>
+#include <states/shooter/ShooterReadiness.h>
+#include <states/shooter/ShooterState.h>
+#include <states/shooter/ShooterStateAutoHigh.h>
+#include <states/shooter/ShooterStateManual.h>
 #include <states/StateStruc.h>
+#include <states/StateTransitionTable.h>
 #include <hw/DragonLimelight.h>
 #include <subsys/Shooter.h>
 
@@ -32,7 +40,7 @@
 
 // Third Party Includes
 
-class ShooterStateMgr : public StateMgr
+class ShooterStateMgr final : public StaticStateMgr<ShooterStateMgr, ShooterState, ShooterStateManual, ShooterStateAutoHigh>
 {
     public:
         /// @enum the various states of the Intake
@@ -45,14 +53,21 @@ class ShooterStateMgr : public StateMgr
             SHOOT_MANUAL,
             PREPARE_TO_SHOOT
         };
-        const std::string m_shooterOffXmlString = "SHOOTER_OFF";
-        const std::string m_shooterHighGoalCloseXmlString = "SHOOT_HIGHGOAL_CLOSE";
-        const std::string m_shooterHighGoalFarXmlString = "SHOOT_HIGHGOAL_FAR";
-        const std::string m_shooterLowGoalXmlString = "SHOOT_LOWGOAL";
-        const std::string m_shooterManualXmlString = "MANUAL_SHOOT";
-        const std::string m_shooterPrepareXmlString = "PREPARETOSHOOT";
+        // static, so the auton parser can use them before the shooter is created
+        static inline const std::string m_shooterOffXmlString = "SHOOTER_OFF";
+        static inline const std::string m_shooterHighGoalCloseXmlString = "SHOOT_HIGHGOAL_CLOSE";
+        static inline const std::string m_shooterHighGoalFarXmlString = "SHOOT_HIGHGOAL_FAR";
+        static inline const std::string m_shooterLowGoalXmlString = "SHOOT_LOWGOAL";
+        static inline const std::string m_shooterManualXmlString = "MANUAL_SHOOT";
+        static inline const std::string m_shooterPrepareXmlString = "PREPARETOSHOOT";
+
+        // dashboard entries (shooter network table) for adding a shot to the shot map
+        static inline const std::string m_addShotNtString = "Shot Map - Add";
+        static inline const std::string m_shotTopNtString = "Shot Map - New Top";
+        static inline const std::string m_shotBottomNtString = "Shot Map - New Bottom";
+        static inline const std::string m_shotHoodNtString = "Shot Map - New Hood";
         
-        const std::map<const std::string, SHOOTER_STATE> m_shooterXmlStringToStateEnumMap
+        static inline const std::map<const std::string, SHOOTER_STATE> m_shooterXmlStringToStateEnumMap
         {   {m_shooterOffXmlString, SHOOTER_STATE::OFF},
             {m_shooterHighGoalCloseXmlString, SHOOTER_STATE::AUTO_SHOOT_HIGH_GOAL_CLOSE},
             {m_shooterHighGoalFarXmlString, SHOOTER_STATE::AUTO_SHOOT_HIGH_GOAL_FAR},
@@ -69,15 +84,59 @@ class ShooterStateMgr : public StateMgr
         void CheckForStateTransition() override;
         bool AtTarget() const;
         bool IsShooting() const;
+
+        /// @brief  Can the lift feed a ball now.  Under velocity control, once the prediction has 
+        ///         proven accurate, this is true when the flywheels are predicted to be at speed by 
+        ///         the time the ball reaches them;  otherwise it is AtTarget.
+        /// @return bool - true if a ball can be fed
+        bool IsReadyToFeed() const;
+
+    protected:
+        IState* CreateState
+        (
+            const StateStruc&               struc,
+            const MechanismTargetData*      targetData
+        ) override;
+
     private:
 
+        /// @brief  input bits for the transition table
+        enum SHOOTER_INPUT
+        {
+            SHOOT_HIGH_PRESSED      = 1 << 0,
+            SHOOT_LOW_PRESSED       = 1 << 1,
+            MANUAL_SHOOT_PRESSED    = 1 << 2,
+            SHOOTER_OFF_PRESSED     = 1 << 3,   // shooter off or enable climber
+            PREPARE_PRESSED         = 1 << 4,
+            ANY_PRESSED             = (1 << 5) - 1
+        };
+
         ShooterStateMgr();
         ~ShooterStateMgr() = default;
+
+        /// @brief  Is the limelight lined up with the goal (true if there is no limelight)
+        bool IsAligned() const;
+
+        /// @brief  Does the state run both flywheels under closed loop velocity control
+        bool IsVelocityState
+        (
+            int         state
+        ) const;
+
+        /// @brief  Add the dashboard's shot at the current limelight distance to the shot map when
+        ///         the dashboard's add button is pressed
+        void AddShotFromDashboard();
+
+        /// @brief  Publish the shot map to the dashboard as shotPoint elements for shooter.xml
+        void PublishShotMap();
         
         DragonLimelight* m_dragonLimeLight;
         Shooter*                                m_shooter;
         std::shared_ptr<nt::NetworkTable>       m_nt;
-        bool m_buttonTriggerStateChange;
+        StateTransitionTable                    m_transitions;
+        ShooterReadiness                        m_readiness;
+        ShotMap                                 m_shotMap;          // used by the AUTO_SHOOT_HIGH states
+        std::vector<bool>                       m_velocityStates;   // by state id:  closed loop velocity targets
 
 
         const double m_CHANGE_STATE_TARGET = 120.0; 
@@ -60,6 +60,10 @@ class ChassisFactory
 
 			inline SwerveChassis* GetSwerveChassis() {return (SwerveChassis*) m_chassis; };
 
+			/// @brief  Use a chassis that wasn't built from the robot XML (e.g. the simulated chassis the
+			///         auton tests drive).  Call before anything that caches the chassis is created.
+			inline void SetChassis(IChassis* chassis) { m_chassis = chassis; };
+
 			//=======================================================================================
 			// Method:  		CreateChassis
 			// Description:		Create a chassis from the inputs
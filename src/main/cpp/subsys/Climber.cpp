@@ -14,6 +14,8 @@
 //====================================================================================================================================================
 
 // C++ Includes
+#include <cmath>
+#include <limits>
 #include <memory>
 #include <string>
 
@@ -33,17 +35,33 @@
 // Third Party Includes
 using namespace std;
 
+namespace
+{
+    /// @brief  the soft limit if the motor has one (unset limits are +/- max), otherwise the fallback
+    double SoftLimitOr
+    (
+        double  limit,
+        double  fallback
+    )
+    {
+        return abs(limit) == numeric_limits<double>::max() ? fallback : limit;
+    }
+}
+
 Climber::Climber
 (
     shared_ptr<IDragonMotorController>      liftMotor,
     shared_ptr<IDragonMotorController>      rotateMotor,
     std::shared_ptr<DragonDigitalInput>     armBackSw
 ) : Mech2IndMotors( MechanismTypes::MECHANISM_TYPE::CLIMBER,  string("climber.xml"),  string("ClimberNT"), liftMotor, rotateMotor ),
-    m_reachMin(-1.0), //bottom of lift
-    m_reachMax(19.25), //top of lift
-    m_rotateMin(0.0), //start of rotation
-    m_rotateMax(130.0), //untested max rotation
-    m_armBack(armBackSw)
+    // the travel limits are the soft limits in the robot definition (inches and degrees);  a robot 
+    // that doesn't set them (e.g. the practice bot) uses the climber's limits in software
+    m_reachMin(SoftLimitOr(liftMotor.get()->GetReverseSoftLimit(), DEFAULT_REACH_MIN)),
+    m_reachMax(SoftLimitOr(liftMotor.get()->GetForwardSoftLimit(), DEFAULT_REACH_MAX)),
+    m_rotateMin(SoftLimitOr(rotateMotor.get()->GetReverseSoftLimit(), DEFAULT_ROTATE_MIN)),
+    m_rotateMax(SoftLimitOr(rotateMotor.get()->GetForwardSoftLimit(), DEFAULT_ROTATE_MAX)),
+    m_armBack(armBackSw),
+    m_loopCount(0)
 {
     liftMotor.get()->SetFramePeriodPriority(IDragonMotorController::MOTOR_PRIORITY::LOW);
     rotateMotor.get()->SetFramePeriodPriority(IDragonMotorController::MOTOR_PRIORITY::LOW);
@@ -65,16 +83,35 @@ void Climber::Update()
     auto ntName = GetNetworkTableName();
     auto table = nt::NetworkTableInstance::GetDefault().GetTable(ntName);
 
+    // the re-zero and the logging read the motors over CAN, so they only run every few loops
+    auto slowLoop = m_loopCount == 0;
+    m_loopCount = (m_loopCount + 1) % SLOW_LOOPS;
+
     auto liftMotor = GetPrimaryMotor();
     if ( liftMotor.get() != nullptr )
     {
         auto liftTarget = GetPrimaryTarget();
-        auto currentPos = GetPositionInInches(liftMotor);
-        auto atMinReach = IsAtMinReach(liftMotor, currentPos);
-        auto atMaxReach = IsAtMaxReach(liftMotor, currentPos);
+        auto stop = false;
 
-        /** **/
-        if ((atMinReach && liftTarget <= currentPos) || (atMaxReach && liftTarget >= currentPos))
+        // the soft limits trust the encoder, so keep correcting it from the switch or a stall
+        if ( slowLoop )
+        {
+            RezeroLift(liftMotor);
+        }
+
+        // the travel limits are normally enforced on the motor controller; only read the 
+        // position and check them here as a fallback when the controller isn't handling them
+        auto checkMin = !liftMotor.get()->IsReverseLimitEnforced();
+        auto checkMax = !liftMotor.get()->IsForwardLimitEnforced();
+        if ( checkMin || checkMax )
+        {
+            auto currentPos = GetPositionInInches(liftMotor);
+            auto atMinReach = checkMin && IsAtMinReach(liftMotor, currentPos);
+            auto atMaxReach = checkMax && IsAtMaxReach(liftMotor, currentPos);
+            stop = (atMinReach && liftTarget <= currentPos) || (atMaxReach && liftTarget >= currentPos);
+        }
+
+        if ( stop )
         {
             liftMotor.get()->GetSpeedController()->StopMotor();
         }
@@ -82,17 +119,31 @@ void Climber::Update()
         {
             liftMotor.get()->Set(table, liftTarget);
         }
-        /** **/    
-   }
+    }
+
     auto rotateMotor = GetSecondaryMotor();
     if ( rotateMotor.get() != nullptr)
     {
         auto rotateTarget = GetSecondaryTarget();
-        auto currentPos = GetPositionInDegrees(rotateMotor);
-        auto atMinRot = IsAtMinRotation(rotateMotor, currentPos);
-        auto atMaxRot = IsAtMaxRotation(rotateMotor, currentPos);
-        /** **/
-        if ((atMinRot && rotateTarget <= currentPos) || (atMaxRot && rotateTarget >= currentPos))
+        auto stop = false;
+
+        // the arm back switch is wired to the RIO, so rezero from it here
+        if ( m_armBack.get() != nullptr && m_armBack.get()->Get() )
+        {
+            rotateMotor.get()->SetIntegratedSensorPosition(0.0, 0.0);
+        }
+
+        auto checkMin = !rotateMotor.get()->IsReverseLimitEnforced();
+        auto checkMax = !rotateMotor.get()->IsForwardLimitEnforced();
+        if ( checkMin || checkMax )
+        {
+            auto currentPos = GetPositionInDegrees(rotateMotor);
+            auto atMinRot = checkMin && IsAtMinRotation(rotateMotor, currentPos);
+            auto atMaxRot = checkMax && IsAtMaxRotation(rotateMotor, currentPos);
+            stop = (atMinRot && rotateTarget <= currentPos) || (atMaxRot && rotateTarget >= currentPos);
+        }
+
+        if ( stop )
         {
             rotateMotor.get()->GetSpeedController()->StopMotor();
         }
@@ -102,7 +153,10 @@ void Climber::Update()
         }
     }
 
-    LogData();
+    if ( slowLoop )
+    {
+        LogData();
+    }
 }
 
 bool Climber::IsAtMaxReach
@@ -124,18 +178,23 @@ bool Climber::IsAtMinReach
 {
     auto atMin = currentHeight <= m_reachMin;
     atMin = !atMin ? liftMotor.get()->IsReverseLimitSwitchClosed() : atMin;
+    return atMin;
+}
+void Climber::RezeroLift
+(
+    std::shared_ptr<IDragonMotorController> liftMotor
+) const
+{
     //If we hit bottom limit switch, zero lift motor to get correct encoder counts for position
     if (liftMotor.get()->IsReverseLimitSwitchClosed())
     {
         liftMotor.get()->SetIntegratedSensorPosition(0.0, 0.0);
     }
     //Failsafe in case we lose bottom limit switch, rely on stall code to zero lift motor
-
-    if (IsLiftStalled())
+    else if (IsLiftStalled())
     {
         liftMotor.get()->SetIntegratedSensorPosition(0.0, 0.0);
     }
-    return atMin;
 }
 bool Climber::IsAtMinRotation
 (
@@ -164,12 +223,12 @@ bool Climber::IsAtMaxRotation
 bool Climber::IsLiftStalled() const
 {
     auto liftMotor = GetPrimaryMotor();
-    return liftMotor.get() != nullptr ? MotorData::GetInstance()->checkIfStall(liftMotor) : false;
+    return liftMotor.get() != nullptr ? MotorData::checkIfStall(liftMotor) : false;
 }
 bool Climber::IsRotateStalled() const
 {
     auto rotateMotor = GetSecondaryMotor();
-    return rotateMotor.get() != nullptr ? MotorData::GetInstance()->checkIfStall(rotateMotor) : false;
+    return rotateMotor.get() != nullptr ? MotorData::checkIfStall(rotateMotor) : false;
 }
 
 
@@ -76,6 +76,13 @@ class Climber : public Mech2IndMotors
         ) const;
 
     private:
+        /// @brief  zero the lift encoder when the lift is at the bottom (reverse limit switch closed
+        ///         or, as a failsafe if the switch fails, the motor is stalled)
+        void RezeroLift
+        (
+            std::shared_ptr<IDragonMotorController> motor
+        ) const;
+
         static double GetPositionInInches
         (
             std::shared_ptr<IDragonMotorController> motor
@@ -85,10 +92,19 @@ class Climber : public Mech2IndMotors
             std::shared_ptr<IDragonMotorController> motor
         );
 
+        // travel limits when the robot definition doesn't give the motor soft limits
+        static constexpr double DEFAULT_REACH_MIN  = -1.0;     // bottom of lift (inches)
+        static constexpr double DEFAULT_REACH_MAX  = 19.25;    // top of lift (inches)
+        static constexpr double DEFAULT_ROTATE_MIN = 0.0;      // start of rotation (degrees)
+        static constexpr double DEFAULT_ROTATE_MAX = 130.0;    // untested max rotation (degrees)
+
         double                              m_reachMin;
         double                              m_reachMax;
         double                              m_rotateMin;
         double                              m_rotateMax;
         std::shared_ptr<DragonDigitalInput> m_armBack;
+        int                                 m_loopCount;
+
+        static constexpr int                SLOW_LOOPS = 5;     // loops between the re-zero and log reads (10 Hz)
         //DragonAnalogInput*                  m_elevatorHeight;
 };
\ No newline at end of file
@@ -53,7 +53,8 @@ bool Intake::StopIfFullyExtended() const
     if (motor.get() != nullptr)
     {
         auto fullyExtended = motor.get()->IsForwardLimitSwitchClosed();
-        if (fullyExtended)
+        // the controller already stops the motor at the limit switch, so only command zero as a fallback
+        if (fullyExtended && !motor.get()->IsForwardLimitEnforced())
         {
             motor.get()->Set(0.0);
         }
@@ -69,9 +70,9 @@ bool Intake::StopIfRetracted() const
         auto fullyRetracted = motor.get()->IsReverseLimitSwitchClosed();
         /*if (!fullyRetracted)
         {
-            fullyRetracted = MotorData::GetInstance()->checkIfStall(motor);
+            fullyRetracted = MotorData::checkIfStall(motor);
         }*/
-        if (fullyRetracted)
+        if (fullyRetracted && !motor.get()->IsReverseLimitEnforced())
         {
             motor.get()->Set(0.0);
         }
@@ -0,0 +1,155 @@
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302 
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+// C++ Includes
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+
+// FRC includes
+
+// Team 302 includes
+#include <utils/Arena.h>
+
+// Third Party Includes
+
+using namespace std;
+
+Arena* Arena::m_configArena = nullptr;
+Arena* Arena::GetConfigArena()
+{
+    if ( Arena::m_configArena == nullptr )
+    {
+        Arena::m_configArena = new Arena();
+    }
+    return Arena::m_configArena;
+}
+
+Arena::Arena
+(
+    size_t      chunkSize
+) : m_chunkSize(chunkSize),
+    m_chunks(),
+    m_current(0),
+    m_offset(0),
+    m_used(0),
+    m_destructors(nullptr),
+    m_resetHandlers(),
+    m_rebuildHandlers(),
+    m_mutex()
+{
+}
+
+Arena::~Arena()
+{
+    Reset();
+}
+
+void* Arena::Allocate
+(
+    size_t      size,
+    size_t      alignment
+)
+{
+    lock_guard<recursive_mutex> lock(m_mutex);
+    return AllocateLocked(size, alignment);
+}
+
+void* Arena::AllocateLocked
+(
+    size_t      size,
+    size_t      alignment
+)
+{
+    // fill the chunks in order;  a chunk that can't hold the object is left with a gap
+    for ( ; m_current < m_chunks.size(); ++m_current, m_offset = 0 )
+    {
+        auto& chunk = m_chunks[m_current];
+        auto base = reinterpret_cast<uintptr_t>( chunk.memory.get() );
+        auto start = ( base + m_offset + alignment - 1 ) & ~( alignment - 1 );
+        if ( start + size <= base + chunk.size )
+        {
+            m_offset = start + size - base;
+            m_used += size;
+            return reinterpret_cast<void*>( start );
+        }
+    }
+
+    auto chunkSize = max( m_chunkSize, size + alignment );
+    m_chunks.emplace_back( Chunk{ make_unique<byte[]>( chunkSize ), chunkSize } );
+    return AllocateLocked( size, alignment );
+}
+
+void Arena::AddResetHandler
+(
+    function<void()>    handler
+)
+{
+    lock_guard<recursive_mutex> lock(m_mutex);
+    m_resetHandlers.emplace_back( handler );
+}
+
+void Arena::AddRebuildHandler
+(
+    function<void()>    handler
+)
+{
+    lock_guard<recursive_mutex> lock(m_mutex);
+    m_rebuildHandlers.emplace_back( handler );
+}
+
+void Arena::Reset()
+{
+    lock_guard<recursive_mutex> lock(m_mutex);
+    for ( auto& handler : m_resetHandlers )
+    {
+        handler();
+    }
+
+    while ( m_destructors != nullptr )
+    {
+        auto node = m_destructors;
+        m_destructors = node->next;
+        node->destroy( node->object );
+    }
+    m_current = 0;
+    m_offset = 0;
+    m_used = 0;
+}
+
+void Arena::Rebuild()
+{
+    lock_guard<recursive_mutex> lock(m_mutex);
+    Reset();
+
+    // by index: a handler can create an object whose constructor adds a handler
+    for ( size_t inx=0; inx<m_rebuildHandlers.size(); ++inx )
+    {
+        auto handler = m_rebuildHandlers[inx];
+        handler();
+    }
+}
+
+size_t Arena::Capacity() const
+{
+    size_t capacity = 0;
+    for ( auto& chunk : m_chunks )
+    {
+        capacity += chunk.size;
+    }
+    return capacity;
+}
@@ -0,0 +1,149 @@
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302 
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+#pragma once
+
+// C++ Includes
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// FRC includes
+
+// Team 302 includes
+
+// Third Party Includes
+
+
+/// @class Arena
+/// @brief Bump allocator for objects that live as long as the robot program: the states, their 
+///        controllers and the parsed state data.  Objects are placed one after another in large 
+///        chunks, so each mechanism's states end up next to each other in memory (the mechanisms are
+///        initialized one at a time) and nothing is freed individually.  Reset destroys every object 
+///        (in reverse order), tells the users of the arena to forget their pointers and reuses the
+///        memory;  after a Reset the state managers have no states and do nothing.  Rebuild resets the
+///        arena and then has its users create their objects again (the state managers re-read their
+///        configuration files and create their states), e.g. to start each test from a fresh robot.
+class Arena
+{
+    public:
+        /// @brief  Default chunk size in bytes (bigger objects get a chunk of their own)
+        static constexpr size_t CHUNK_SIZE = 16 * 1024;
+
+        /// @brief  The arena for everything created from the robot configuration
+        /// @return Arena* - the configuration arena
+        static Arena* GetConfigArena();
+
+        explicit Arena
+        (
+            size_t      chunkSize = CHUNK_SIZE
+        );
+        Arena(const Arena&) = delete;
+        Arena& operator=(const Arena&) = delete;
+        ~Arena();
+
+        /// @brief  Construct an object in the arena.  It is destroyed by Reset (or when the arena is).
+        /// @return T* - the object
+        template <typename T, typename... Args>
+        T* Create
+        (
+            Args&&...   args
+        )
+        {
+            std::lock_guard<std::recursive_mutex> lock(m_mutex);
+            auto object = new ( AllocateLocked(sizeof(T), alignof(T)) ) T( std::forward<Args>(args)... );
+            if constexpr ( !std::is_trivially_destructible_v<T> )
+            {
+                auto node = new ( AllocateLocked(sizeof(Destructor), alignof(Destructor)) ) Destructor;
+                node->destroy = [](void* obj) { static_cast<T*>(obj)->~T(); };
+                node->object = object;
+                node->next = m_destructors;
+                m_destructors = node;
+            }
+            return object;
+        }
+
+        /// @brief  Raw memory from the arena (nothing is destroyed for it)
+        void* Allocate
+        (
+            size_t      size,
+            size_t      alignment
+        );
+
+        /// @brief  Add something to do when the arena is reset (e.g. forget pointers into it)
+        void AddResetHandler
+        (
+            std::function<void()>   handler
+        );
+
+        /// @brief  Add something to do when the arena is rebuilt, after it is reset (e.g. create the
+        ///         states again)
+        void AddRebuildHandler
+        (
+            std::function<void()>   handler
+        );
+
+        /// @brief  Destroy everything in the arena and reuse its memory.  Only call this once nothing 
+        ///         is using the objects (e.g. when the program ends); the reset handlers are called 
+        ///         first.  Nothing is created again afterwards (see Rebuild).
+        void Reset();
+
+        /// @brief  Reset, then call the rebuild handlers in the order they were added.  Call from the 
+        ///         robot thread while nothing is running the states.
+        void Rebuild();
+
+        /// @brief  Bytes handed out since the last reset
+        size_t BytesUsed() const { return m_used; }
+
+        /// @brief  Bytes in the chunks
+        size_t Capacity() const;
+
+    private:
+        struct Chunk
+        {
+            std::unique_ptr<std::byte[]>    memory;
+            size_t                          size;
+        };
+
+        struct Destructor
+        {
+            void            (*destroy)(void*);
+            void*           object;
+            Destructor*     next;
+        };
+
+        void* AllocateLocked
+        (
+            size_t      size,
+            size_t      alignment
+        );
+
+        size_t                              m_chunkSize;
+        std::vector<Chunk>                  m_chunks;
+        size_t                              m_current;      // chunk being filled
+        size_t                              m_offset;       // next free byte in the chunk
+        size_t                              m_used;
+        Destructor*                         m_destructors;  // most recent object first
+        std::vector<std::function<void()>>  m_resetHandlers;
+        std::vector<std::function<void()>>  m_rebuildHandlers;
+        std::recursive_mutex                m_mutex;        // states can create objects while they are created
+
+        static Arena*                       m_configArena;
+};
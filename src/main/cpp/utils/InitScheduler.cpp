@@ -0,0 +1,89 @@
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302 
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+// C++ Includes
+#include <string>
+
+// FRC includes
+#include <frc/Timer.h>
+
+// Team 302 includes
+#include <utils/InitScheduler.h>
+#include <utils/Logger.h>
+
+// Third Party Includes
+
+using namespace std;
+
+InitScheduler::InitScheduler
+(
+    string      ntName
+) : m_ntName(ntName),
+    m_steps(),
+    m_current(0)
+{
+}
+
+void InitScheduler::AddStep
+(
+    string                  name,
+    function<bool()>        step
+)
+{
+    Logger::GetLogger()->ToNtTable(m_ntName, name, string("pending"));
+    m_steps.emplace_back(InitStep{name, step, false, 0.0});
+}
+
+bool InitScheduler::RunNext()
+{
+    if ( !IsDone() )
+    {
+        auto& current = m_steps[m_current];
+        auto start = frc::Timer::GetFPGATimestamp();
+        auto complete = current.step ? current.step() : true;
+        current.seconds += (frc::Timer::GetFPGATimestamp() - start).value();
+
+        if ( complete )
+        {
+            current.ready = true;
+            Logger::GetLogger()->ToNtTable(m_ntName, current.name, string("ready"));
+            Logger::GetLogger()->ToNtTable(m_ntName, current.name + string(" seconds"), current.seconds);
+            m_current++;
+        }
+    }
+    return !IsDone();
+}
+
+void InitScheduler::RunAll()
+{
+    while ( RunNext() )
+    {
+    }
+}
+
+bool InitScheduler::IsReady
+(
+    const string&   name
+) const
+{
+    for ( auto& step : m_steps )
+    {
+        if ( step.name == name )
+        {
+            return step.ready;
+        }
+    }
+    return false;
+}
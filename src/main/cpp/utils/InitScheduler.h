@@ -0,0 +1,83 @@
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302 
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+#pragma once
+
+// C++ Includes
+#include <functional>
+#include <string>
+#include <vector>
+
+// FRC includes
+
+// Team 302 includes
+
+// Third Party Includes
+
+
+/// @class InitScheduler
+/// @brief Runs the robot's non-critical initialization a piece at a time so the robot is drivable as
+///        soon as the chassis is created.  Steps run in the order they are added.  A step returns
+///        true when it is complete; a step that returns false is called again on the next RunNext
+///        (e.g. to create one mechanism per call).  The readiness of each step and the time it took
+///        are written to the network table.
+class InitScheduler
+{
+    public:
+        InitScheduler
+        (
+            std::string     ntName
+        );
+        InitScheduler() = delete;
+        ~InitScheduler() = default;
+
+        /// @brief  Add a step to the end of the schedule
+        /// @param [in] std::string name - step name used for the readiness flag
+        /// @param [in] std::function<bool()> step - work to do; returns true when the step is complete
+        void AddStep
+        (
+            std::string             name,
+            std::function<bool()>   step
+        );
+
+        /// @brief  Run one call of the current step (call this from DisabledPeriodic)
+        /// @return bool - true if there is still work left
+        bool RunNext();
+
+        /// @brief  Run everything that is left (call this before the robot is enabled)
+        void RunAll();
+
+        /// @brief  Has the named step completed
+        bool IsReady
+        (
+            const std::string&      name
+        ) const;
+
+        /// @brief  Have all of the steps completed
+        bool IsDone() const { return m_current >= m_steps.size(); }
+
+    private:
+        struct InitStep
+        {
+            std::string             name;
+            std::function<bool()>   step;
+            bool                    ready;
+            double                  seconds;
+        };
+
+        std::string                 m_ntName;
+        std::vector<InitStep>       m_steps;
+        unsigned int                m_current;
+};
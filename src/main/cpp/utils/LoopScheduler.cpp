@@ -0,0 +1,171 @@
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302 
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+// C++ Includes
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <string>
+
+// FRC includes
+#include <frc/Timer.h>
+
+// Team 302 includes
+#include <utils/LoopScheduler.h>
+#include <utils/Logger.h>
+
+// Third Party Includes
+
+using namespace std;
+
+LoopScheduler::LoopScheduler
+(
+    string      ntName,
+    double      loopRate
+) : m_ntName(ntName),
+    m_loopRate(loopRate),
+    m_tasks(),
+    m_loop(0),
+    m_tasksRun(0),
+    m_lastLoopSeconds(0.0),
+    m_maxLoopSeconds(0.0)
+{
+}
+
+void LoopScheduler::AddTask
+(
+    string                  name,
+    function<void()>        task,
+    double                  rate,
+    double                  idleRate,
+    function<bool()>        isIdle,
+    int                     phase
+)
+{
+    auto period = ToPeriod(rate);
+    auto idlePeriod = (isIdle && idleRate > 0.0) ? max(period, ToPeriod(idleRate)) : period;
+    if ( phase == AUTO_PHASE )
+    {
+        phase = static_cast<int>(PickPhase(idlePeriod));
+    }
+    else if ( phase < 0 || static_cast<unsigned int>(phase) >= idlePeriod )
+    {
+        Logger::GetLogger()->LogError(string("LoopScheduler::AddTask"), name + string(" phase is not within its period"));
+        phase = static_cast<int>(static_cast<unsigned int>(abs(phase)) % idlePeriod);
+    }
+    m_tasks.emplace_back(LoopTask{name, task, period, idlePeriod, static_cast<unsigned int>(phase), isIdle, 0, 0.0, 0.0, 0.0});
+}
+
+unsigned int LoopScheduler::ToPeriod
+(
+    double                  rate
+) const
+{
+    return rate > 0.0 ? max(1U, static_cast<unsigned int>(lround(m_loopRate / rate))) : 1U;
+}
+
+unsigned int LoopScheduler::PickPhase
+(
+    unsigned int            period
+) const
+{
+    if ( period <= 1 )
+    {
+        return 0;
+    }
+
+    // count the tasks that would share each loop with this one over a full cycle of the periods
+    constexpr unsigned int maxHorizon = 3000;
+    unsigned int horizon = period;
+    for ( auto& task : m_tasks )
+    {
+        horizon = min(maxHorizon, lcm(horizon, task.idlePeriod));
+    }
+
+    auto bestPhase = 0U;
+    auto bestLoad = numeric_limits<unsigned int>::max();
+    for ( auto phase=0U; phase<period; ++phase )
+    {
+        auto load = 0U;
+        for ( auto loop=phase; loop<horizon; loop+=period )
+        {
+            for ( auto& task : m_tasks )
+            {
+                if ( task.idlePeriod > 1 && loop % task.idlePeriod == task.phase )
+                {
+                    ++load;
+                }
+            }
+        }
+        if ( load < bestLoad )
+        {
+            bestLoad = load;
+            bestPhase = phase;
+        }
+    }
+    return bestPhase;
+}
+
+bool LoopScheduler::IsDue
+(
+    const LoopTask&         task
+) const
+{
+    if ( task.idlePeriod > task.period && task.isIdle() )
+    {
+        return m_loop % task.idlePeriod == task.phase;
+    }
+    return m_loop % task.period == task.phase % task.period;
+}
+
+void LoopScheduler::Run()
+{
+    m_tasksRun = 0;
+    auto loopStart = frc::Timer::GetFPGATimestamp().value();
+    auto start = loopStart;
+    for ( auto& task : m_tasks )
+    {
+        if ( IsDue(task) )
+        {
+            task.task();
+
+            auto end = frc::Timer::GetFPGATimestamp().value();
+            task.lastSeconds = end - start;
+            task.maxSeconds = max(task.maxSeconds, task.lastSeconds);
+            task.totalSeconds += task.lastSeconds;
+            task.runs++;
+            m_tasksRun++;
+            start = end;
+        }
+    }
+    m_lastLoopSeconds = start - loopStart;
+    m_maxLoopSeconds = max(m_maxLoopSeconds, m_lastLoopSeconds);
+    m_loop++;
+}
+
+void LoopScheduler::PublishStats() const
+{
+    auto logger = Logger::GetLogger();
+    for ( auto& task : m_tasks )
+    {
+        logger->ToNtTable(m_ntName, task.name + string(" runs"), static_cast<double>(task.runs));
+        logger->ToNtTable(m_ntName, task.name + string(" last ms"), task.lastSeconds * 1000.0);
+        logger->ToNtTable(m_ntName, task.name + string(" max ms"), task.maxSeconds * 1000.0);
+        logger->ToNtTable(m_ntName, task.name + string(" avg ms"), task.runs > 0 ? task.totalSeconds * 1000.0 / static_cast<double>(task.runs) : 0.0);
+    }
+    logger->ToNtTable(m_ntName, string("loop ms"), m_lastLoopSeconds * 1000.0);
+    logger->ToNtTable(m_ntName, string("max loop ms"), m_maxLoopSeconds * 1000.0);
+}
@@ -0,0 +1,117 @@
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302 
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+#pragma once
+
+// C++ Includes
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+// FRC includes
+
+// Team 302 includes
+
+// Third Party Includes
+
+
+/// @class LoopScheduler
+/// @brief Runs the periodic work of the robot's subsystems at the rate each one needs.  A task 
+///        declares its rate and, optionally, a slower rate to use while it is idle (e.g. the climber
+///        at 10 Hz until it is being used).  Tasks that don't run every loop are given a phase 
+///        offset, so their work is spread across loops instead of landing in the same one.  The
+///        execution time of each task is recorded and PublishStats writes it to the network table.
+class LoopScheduler
+{
+    public:
+        /// @brief  Let the scheduler pick the phase that puts the least work in the same loops
+        static constexpr int AUTO_PHASE = -1;
+
+        LoopScheduler
+        (
+            std::string     ntName,
+            double          loopRate        // loops per second (the TimedRobot rate)
+        );
+        LoopScheduler() = delete;
+        ~LoopScheduler() = default;
+
+        /// @brief  Add a task; tasks run in the order they are added
+        /// @param [in] std::string name - task name used for the statistics
+        /// @param [in] std::function<void()> task - work to do
+        /// @param [in] double rate - runs per second (the loop rate or higher runs every loop)
+        /// @param [in] double idleRate - runs per second while isIdle returns true
+        /// @param [in] std::function<bool()> isIdle - true if the task can run at its idle rate (nullptr never idle)
+        /// @param [in] int phase - loop offset within the idle period, or AUTO_PHASE
+        void AddTask
+        (
+            std::string             name,
+            std::function<void()>   task,
+            double                  rate,
+            double                  idleRate = 0.0,
+            std::function<bool()>   isIdle = nullptr,
+            int                     phase = AUTO_PHASE
+        );
+
+        /// @brief  Run the tasks that are due this loop (call once per loop)
+        void Run();
+
+        /// @brief  Restart the loop count (e.g. when the robot is enabled) so the phases line up again
+        void Reset() { m_loop = 0; }
+
+        /// @brief  Write the execution time of each task to the network table
+        void PublishStats() const;
+
+        /// @brief  Number of tasks that ran in the last loop
+        unsigned int GetTasksRun() const { return m_tasksRun; }
+
+    private:
+        struct LoopTask
+        {
+            std::string             name;
+            std::function<void()>   task;
+            unsigned int            period;         // loops between runs
+            unsigned int            idlePeriod;     // loops between runs while idle
+            unsigned int            phase;          // loop within the idle period that it runs in
+            std::function<bool()>   isIdle;
+            uint64_t                runs;
+            double                  lastSeconds;
+            double                  maxSeconds;
+            double                  totalSeconds;
+        };
+
+        unsigned int ToPeriod
+        (
+            double                  rate
+        ) const;
+
+        unsigned int PickPhase
+        (
+            unsigned int            period
+        ) const;
+
+        bool IsDue
+        (
+            const LoopTask&         task
+        ) const;
+
+        std::string                 m_ntName;
+        double                      m_loopRate;
+        std::vector<LoopTask>       m_tasks;
+        uint64_t                    m_loop;
+        unsigned int                m_tasksRun;
+        double                      m_lastLoopSeconds;
+        double                      m_maxLoopSeconds;
+};
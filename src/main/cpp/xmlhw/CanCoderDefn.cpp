@@ -21,6 +21,7 @@
 // wpilib includes
 
 // team 302 includes
+#include <hw/DragonCANBus.h>
 #include <xmlhw/CanCoderDefn.h>
 #include <utils/HardwareIDValidation.h>
 #include <utils/Logger.h>
@@ -47,6 +48,7 @@ shared_ptr<CANCoder> CanCoderDefn::ParseXML
 
     string usage;
     int canID = 0;
+    string canBusName;
     double offset = 0.0;
     bool reverse = false;
     
@@ -63,6 +65,10 @@ shared_ptr<CANCoder> CanCoderDefn::ParseXML
             canID = attr.as_int();
             hasError = HardwareIDValidation::ValidateCANID( canID, string( "CanCoderDefn::ParseXML" ) );
         }        
+        else if ( strcmp( attr.name(), "canBusName" ) == 0 )
+        {
+            canBusName = attr.value();
+        }
         else if ( strcmp( attr.name(), "offset" ) == 0 )
         {
             offset = attr.as_double();
@@ -80,7 +86,10 @@ shared_ptr<CANCoder> CanCoderDefn::ParseXML
     }   
     if(!hasError)
     {
-        cancoder = make_shared<WPI_CANCoder>(canID, "canivore"); //need to add usage also can't use new CANCoder... because it hasn't been wrapped
+        auto bus = DragonCANBus::GetBusName(canBusName, string(DragonCANBus::CANIVORE_BUS));
+        DragonCANBus::GetInstance()->AddDevice(bus, canID, DragonCANBus::CAN_DEVICE_TYPE::CANCODER, usage);
+
+        cancoder = make_shared<WPI_CANCoder>(canID, bus); //need to add usage also can't use new CANCoder... because it hasn't been wrapped
         auto error = cancoder.get()->ConfigFactoryDefault(50);
         if ( error != ErrorCode::OKAY )
         {
@@ -57,6 +57,7 @@ shared_ptr<IDragonMotorController> MotorDefn::ParseXML
     int canID = 0;
 	int pdpID = -1;
 	string usage;
+	string canBusName;
     bool inverted = false;
     bool sensorInverted = false;
     ctre::phoenix::motorcontrol::FeedbackDevice  feedbackDevice = ctre::phoenix::motorcontrol::FeedbackDevice::QuadEncoder;
@@ -74,6 +75,12 @@ shared_ptr<IDragonMotorController> MotorDefn::ParseXML
     bool forwardLimitSwitchNormallyOpen = false;
     bool reverseLimitSwitch = false;
     bool reverseLimitSwitchNormallyOpen = false;
+    bool enableForwardSoftLimit = false;
+    double forwardSoftLimit = 0.0;
+    bool enableReverseSoftLimit = false;
+    double reverseSoftLimit = 0.0;
+    bool clearPositionOnForwardLimit = false;
+    bool clearPositionOnReverseLimit = false;
     double voltageCompensationSaturation = 12.0;
     bool enableVoltageCompensation = false;
     IDragonMotorController::MOTOR_TYPE motortype = IDragonMotorController::NONE;
@@ -95,6 +102,10 @@ shared_ptr<IDragonMotorController> MotorDefn::ParseXML
         {
             canID = attr.as_int();
             hasError = HardwareIDValidation::ValidateCANID( canID, string( "MotorDefn::ParseXML" ) );
+        }
+        else if ( strcmp( attr.name(), "canBusName" ) == 0 )
+        {
+            canBusName = attr.value();
         }
 		// PDP ID 0 thru 15 are valid
         else if ( strcmp( attr.name(), "pdpID" ) == 0 )
@@ -327,6 +338,25 @@ shared_ptr<IDragonMotorController> MotorDefn::ParseXML
         {
             reverseLimitSwitchNormallyOpen = attr.as_bool();
         }
+        // soft limits (degrees if only counts per degree is set, otherwise inches)
+        else if ( strcmp( attr.name(), "forwardSoftLimit") == 0 )
+        {
+            enableForwardSoftLimit = true;
+            forwardSoftLimit = attr.as_double();
+        }
+        else if ( strcmp( attr.name(), "reverseSoftLimit") == 0 )
+        {
+            enableReverseSoftLimit = true;
+            reverseSoftLimit = attr.as_double();
+        }
+        else if ( strcmp( attr.name(), "clearPositionOnForwardLimit") == 0 )
+        {
+            clearPositionOnForwardLimit = attr.as_bool();
+        }
+        else if ( strcmp( attr.name(), "clearPositionOnReverseLimit") == 0 )
+        {
+            clearPositionOnReverseLimit = attr.as_bool();
+        }
         else if (strcmp( attr.name(), "voltageCompensationSaturation"))
         {
             voltageCompensationSaturation = attr.as_double();
@@ -368,9 +398,16 @@ shared_ptr<IDragonMotorController> MotorDefn::ParseXML
                                                                                          forwardLimitSwitchNormallyOpen,
                                                                                          reverseLimitSwitch,
                                                                                          reverseLimitSwitchNormallyOpen,
+                                                                                         enableForwardSoftLimit,
+                                                                                         forwardSoftLimit,
+                                                                                         enableReverseSoftLimit,
+                                                                                         reverseSoftLimit,
+                                                                                         clearPositionOnForwardLimit,
+                                                                                         clearPositionOnReverseLimit,
                                                                                          voltageCompensationSaturation,
                                                                                          enableVoltageCompensation,
-                                                                                         motortype);
+                                                                                         motortype,
+                                                                                         canBusName);
     }
     return controller;
 }
@@ -49,6 +49,7 @@ DragonPigeon* PigeonDefn::ParseXML
 
     // initialize attributes to default values
     int canID = 0;
+    string canBusName;
     double rotation = 0.0;
     DragonPigeon::PIGEON_TYPE type = DragonPigeon::PIGEON_TYPE::PIGEON1;
     DragonPigeon::PIGEON_USAGE usage = DragonPigeon::PIGEON_USAGE::CENTER_OF_ROBOT;
@@ -63,6 +64,10 @@ DragonPigeon* PigeonDefn::ParseXML
             canID = attr.as_int();
             hasError = HardwareIDValidation::ValidateCANID( canID, string( "Pigeon::ParseXML" ) );
         }
+        else if ( strcmp( attr.name(), "canBusName" ) == 0 )
+        {
+            canBusName = attr.value();
+        }
         else if ( strcmp( attr.name(), "rotation") == 0 )
         {
             rotation = attr.as_double();
@@ -103,6 +108,7 @@ DragonPigeon* PigeonDefn::ParseXML
     {
         Logger::GetLogger()->OnDash(string("RobotXML Parsing"), string("Create Pigeon"));
         pigeon = PigeonFactory::GetFactory()->CreatePigeon( canID, 
+                                                            canBusName,
                                                             type,
                                                             usage,
                                                             rotation );
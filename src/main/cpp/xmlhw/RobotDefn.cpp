@@ -37,6 +37,7 @@
 #include <frc/Filesystem.h>
 
 // Team 302 includes
+#include <hw/DragonCANBus.h>
 #include <hw/DragonPigeon.h>
 #include <utils/Logger.h>
 #include <xmlhw/CameraDefn.h>
@@ -55,12 +56,21 @@ using namespace pugi;
 using namespace std;
 
 
+RobotDefn::RobotDefn() : m_doc(),
+                         m_deferredMechanisms(),
+                         m_nextMechanism(0)
+{
+}
+
 //-----------------------------------------------------------------------
 // Method:      ParseXML
 // Description: Parse a robot.xml file
 // Returns:     void
 //-----------------------------------------------------------------------
-void RobotDefn::ParseXML()
+void RobotDefn::ParseXML
+(
+    bool        deferMechanisms
+)
 {
     // set the file to parse
 	auto deployDir = frc::filesystem::GetDeployDirectory();
@@ -68,9 +78,12 @@ void RobotDefn::ParseXML()
 
     try
     {
-       // load the xml file into memory (parse it)
-        xml_document doc;
+       // load the xml file into memory (parse it); the document is kept so deferred mechanisms can be parsed later
+        m_doc = make_unique<xml_document>();
+        auto& doc = *m_doc.get();
         xml_parse_result result = doc.load_file(filename.c_str());
+        m_deferredMechanisms.clear();
+        m_nextMechanism = 0;
 
         // if it is good
         if (result)
@@ -95,7 +108,14 @@ void RobotDefn::ParseXML()
                     }
                     else if (strcmp(child.name(), "mechanism") == 0)
                     {
-                        mechanismXML.get()->ParseXML(child);
+                        if ( deferMechanisms )
+                        {
+                            m_deferredMechanisms.emplace_back(child);
+                        }
+                        else
+                        {
+                            mechanismXML.get()->ParseXML(child);
+                        }
                     }
                     else if (strcmp(child.name(), "camera") == 0)
                     {
@@ -121,6 +141,13 @@ void RobotDefn::ParseXML()
                     }
                 }
             }
+
+            // once all of the CAN devices have been created, report the bus topology / load
+            if ( m_deferredMechanisms.empty() )
+            {
+                DragonCANBus::GetInstance()->CheckLoad();
+                m_doc.reset();
+            }
         }
         else
         {
@@ -148,3 +175,34 @@ void RobotDefn::ParseXML()
         Logger::GetLogger()->LogError( string("RobotDefn::ParseXML"), string("Error thrown while parsing robot.xml") );
     }
 }
+
+//-----------------------------------------------------------------------
+// Method:      ParseNextMechanism
+// Description: Create the next deferred mechanism
+// Returns:     bool       true if all of the deferred mechanisms have been created
+//-----------------------------------------------------------------------
+bool RobotDefn::ParseNextMechanism()
+{
+    if ( m_nextMechanism < m_deferredMechanisms.size() )
+    {
+        try
+        {
+            unique_ptr<MechanismDefn> mechanismXML = make_unique<MechanismDefn>();
+            mechanismXML.get()->ParseXML( m_deferredMechanisms[m_nextMechanism] );
+        }
+        catch(const std::exception& e)
+        {
+            Logger::GetLogger()->LogError( string("RobotDefn::ParseNextMechanism"), string("Error thrown while parsing mechanism") );
+        }
+        m_nextMechanism++;
+
+        if ( m_nextMechanism >= m_deferredMechanisms.size() )
+        {
+            DragonCANBus::GetInstance()->CheckLoad();
+            m_deferredMechanisms.clear();
+            m_nextMechanism = 0;
+            m_doc.reset();
+        }
+    }
+    return m_deferredMechanisms.empty();
+}
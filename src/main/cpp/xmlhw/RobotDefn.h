@@ -16,6 +16,13 @@
 
 #pragma once
 
+// C++ Includes
+#include <memory>
+#include <vector>
+
+// Third Party Includes
+#include <pugixml/pugixml.hpp>
+
 //========================================================================================================
 /// RobotDefn.h
 //========================================================================================================
@@ -30,17 +37,37 @@
 ///
 ///     The robot definition XML file is:  /home/lvuser/config/robot.xml
 ///
+///     The mechanisms can be deferred so the chassis is available right away; the deferred mechanisms
+///     are then created one at a time with ParseNextMechanism.
+///
 //========================================================================================================
 class RobotDefn
 {
     public:
-        RobotDefn() = default;
+        RobotDefn();
         virtual ~RobotDefn() = default;
 
         //================================================================================================
         /// Method:      ParseXML
         /// Description: Parse a robot.xml file
+        ///              deferMechanisms - true:  the mechanism elements are saved for ParseNextMechanism
+        ///                                false: everything is created now
         /// Returns:     void
         //================================================================================================
-        void ParseXML();
+        void ParseXML
+        (
+            bool        deferMechanisms = false
+        );
+
+        //================================================================================================
+        /// Method:      ParseNextMechanism
+        /// Description: Create the next deferred mechanism
+        /// Returns:     bool       true if all of the deferred mechanisms have been created
+        //================================================================================================
+        bool ParseNextMechanism();
+
+    private:
+        std::unique_ptr<pugi::xml_document>     m_doc;
+        std::vector<pugi::xml_node>             m_deferredMechanisms;
+        unsigned int                            m_nextMechanism;
 };
@@ -0,0 +1,98 @@
+//====================================================================================================================================================
+// ShotMapDefn.cpp
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), 
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, 
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF 
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, 
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE 
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+// C++ Includes
+#include <string>
+#include <cstring>
+#include <vector>
+
+// FRC includes
+
+// Team 302 includes
+#include <controllers/ShotMap.h>
+#include <utils/Logger.h>
+#include <xmlmechdata/ShotMapDefn.h>
+
+// Third Party Includes
+#include <pugixml/pugixml.hpp>
+
+using namespace std;
+using namespace pugi;
+
+
+/// @brief      Parse a shotMap XML element 
+/// @param [in] pugi::xml_node  shotMap node
+/// @return     std::vector<ShotMap::Point>     its shotPoint elements (in file order)
+vector<ShotMap::Point> ShotMapDefn::ParseXML
+(
+    xml_node      shotMapNode
+)
+{
+    vector<ShotMap::Point> points;
+
+    for (xml_node child = shotMapNode.first_child(); child; child = child.next_sibling())
+    {
+        if (strcmp(child.name(), "shotPoint") != 0)
+        {
+            string msg = "unknown child ";
+            msg += child.name();
+            Logger::GetLogger()->LogError( string("ShotMapDefn::ParseXML"), msg );
+            continue;
+        }
+
+        ShotMap::Point point = {0.0, 0.0, 0.0, 0.0};
+        bool hasDistance = false;
+        bool hasError = false;
+        for (xml_attribute attr = child.first_attribute(); attr; attr = attr.next_attribute())
+        {
+            if ( strcmp( attr.name(), "distance" ) == 0 )
+            {
+                point.distance = attr.as_double();
+                hasDistance = true;
+            }
+            else if ( strcmp( attr.name(), "top" ) == 0 )
+            {
+                point.top = attr.as_double();
+            }
+            else if ( strcmp( attr.name(), "bottom" ) == 0 )
+            {
+                point.bottom = attr.as_double();
+            }
+            else if ( strcmp( attr.name(), "hood" ) == 0 )
+            {
+                point.hood = attr.as_double();
+            }
+            else
+            {
+                string msg = "invalid attribute ";
+                msg += attr.name();
+                Logger::GetLogger()->LogError( string("ShotMapDefn::ParseXML"), msg );
+                hasError = true;
+            }
+        }
+
+        if ( !hasDistance )
+        {
+            Logger::GetLogger()->LogError( string("ShotMapDefn::ParseXML"), string("shotPoint without a distance") );
+        }
+        else if ( !hasError )
+        {
+            points.emplace_back( point );
+        }
+    }
+    return points;
+}
@@ -0,0 +1,103 @@
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302 
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+// C++ Includes
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+// FRC includes
+
+// Team 302 includes
+#include <subsys/MechanismFactory.h>
+#include <subsys/MechanismTypes.h>
+#include <subsys/interfaces/IMech.h>
+#include <utils/Arena.h>
+#include <utils/Logger.h>
+#include <xmlmechdata/StateDataCache.h>
+#include <xmlmechdata/StateDataDefn.h>
+
+// Third Party Includes
+
+using namespace std;
+
+StateDataCache* StateDataCache::m_instance = nullptr;
+
+StateDataCache* StateDataCache::GetInstance()
+{
+    if ( StateDataCache::m_instance == nullptr )
+    {
+        StateDataCache::m_instance = new StateDataCache();
+    }
+    return StateDataCache::m_instance;
+}
+
+StateDataCache::StateDataCache() : m_mutex(),
+                                   m_stateData()
+{
+    // the data is in the configuration arena, so forget it when the arena is reset
+    Arena::GetConfigArena()->AddResetHandler([this]() { Clear(); });
+}
+
+const StateData* StateDataCache::GetStateData
+(
+    MechanismTypes::MECHANISM_TYPE  mechanism
+)
+{
+    auto mech = MechanismFactory::GetMechanismFactory()->GetMechanism(mechanism);
+    if ( mech == nullptr )
+    {
+        Logger::GetLogger()->LogError( string("StateDataCache::GetStateData"), string("invalid mechanism") );
+        return nullptr;
+    }
+    return GetStateData( mech->GetControlFileName() );
+}
+
+const StateData* StateDataCache::GetStateData
+(
+    const string&   controlFile
+)
+{
+    if ( controlFile.empty() )
+    {
+        Logger::GetLogger()->LogError( string("StateDataCache::GetStateData"), string("mechanism without control file") );
+        return nullptr;
+    }
+
+    lock_guard<mutex> lock(m_mutex);
+    auto itr = m_stateData.find( controlFile );
+    if ( itr == m_stateData.end() )
+    {
+        auto stateXML = make_unique<StateDataDefn>();
+        auto stateData = stateXML.get()->ParseXML( controlFile );
+        itr = m_stateData.emplace( controlFile, Arena::GetConfigArena()->Create<StateData>( move(*stateData) ) ).first;
+        Logger::GetLogger()->ToNtTable( string("StateDataCache"), controlFile, 
+                                        static_cast<double>(itr->second->targetData.size()) );
+    }
+    return itr->second;
+}
+
+size_t StateDataCache::Size()
+{
+    lock_guard<mutex> lock(m_mutex);
+    return m_stateData.size();
+}
+
+void StateDataCache::Clear()
+{
+    lock_guard<mutex> lock(m_mutex);
+    m_stateData.clear();
+}
@@ -0,0 +1,77 @@
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302 
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+#pragma once
+
+// C++ Includes
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+// FRC includes
+
+// Team 302 includes
+#include <subsys/MechanismTypes.h>
+#include <xmlmechdata/StateDataDefn.h>
+
+// Third Party Includes
+
+
+/// @class StateDataCache
+/// @brief Holds the parsed state files, so each file in deploy/states is parsed once no matter how
+///        many state managers use it (e.g. the left and right intakes share a file).  The data is
+///        immutable once it is parsed, so the state managers get read-only views of it and the states
+///        can keep pointers to its control data for the life of the robot.  The data is kept in the 
+///        configuration Arena, which frees it on Reset.
+class StateDataCache
+{
+    public:
+        /// @brief  Find or create the singleton
+        /// @return StateDataCache* - the cache
+        static StateDataCache* GetInstance();
+
+        /// @brief  Get the state data for a mechanism, parsing its control file if it hasn't been
+        /// @param [in] MechanismTypes::MECHANISM_TYPE mechanism - mechanism that the states are for
+        /// @return const StateData* - state data (nullptr if the mechanism doesn't exist)
+        const StateData* GetStateData
+        (
+            MechanismTypes::MECHANISM_TYPE  mechanism
+        );
+
+        /// @brief  Get the state data in a file, parsing it if it hasn't been
+        /// @param [in] const std::string& controlFile - file in the deploy/states directory
+        /// @return const StateData* - state data (nullptr if the file name is empty)
+        const StateData* GetStateData
+        (
+            const std::string&  controlFile
+        );
+
+        /// @brief  Number of files that have been parsed
+        size_t Size();
+
+        /// @brief  Forget everything that has been parsed (the next request parses the file again).
+        ///         Resetting the configuration Arena does this and frees the data.
+        void Clear();
+
+    private:
+        StateDataCache();
+        ~StateDataCache() = default;
+
+        std::mutex                                          m_mutex;
+        std::map<std::string, const StateData*>             m_stateData;
+
+        static StateDataCache*                              m_instance;
+};
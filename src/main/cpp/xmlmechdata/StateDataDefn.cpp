@@ -34,6 +34,7 @@
 #include <memory>
 #include <string>
 #include <cstring>
+#include <vector>
 
 // FRC includes
 #include <frc/Filesystem.h>
@@ -41,11 +42,10 @@
 // Team 302 includes
 #include <controllers/ControlData.h>
 #include <controllers/MechanismTargetData.h>
-#include <subsys/MechanismFactory.h>
-#include <subsys/MechanismTypes.h>
 #include <utils/Logger.h>
 #include <xmlmechdata/ControlDataDefn.h>
 #include <xmlmechdata/MechanismTargetDefn.h>
+#include <xmlmechdata/ShotMapDefn.h>
 #include <xmlmechdata/StateDataDefn.h>
 
 // Third Party Includes
@@ -56,100 +56,108 @@ using namespace std;
 
 
 /// @brief      Parse a mechanismState.xml file
-/// @param [in] MechanismTypes::MECHANISM_TYPE  - mechanism that the states are for
-/// @return     state data
-vector<MechanismTargetData*> StateDataDefn::ParseXML
+/// @param [in] const std::string& controlFile - file in the deploy/states directory
+/// @return     std::unique_ptr<StateData> - state data (no targets if the file couldn't be parsed)
+unique_ptr<StateData> StateDataDefn::ParseXML
 (
-    MechanismTypes::MECHANISM_TYPE mechanism
+    const string&   controlFile
 )
 {
-    bool hasError = false;
-    vector<MechanismTargetData*> targetDataVector;
+    auto stateData = make_unique<StateData>();
 
     // set the file to parse
 	auto filename = frc::filesystem::GetDeployDirectory();
     filename += string("/states/");
-    auto mech = MechanismFactory::GetMechanismFactory()->GetMechanism(mechanism);
-    if (mech == nullptr)
+    if (controlFile.empty())
     {
-        Logger::GetLogger()->LogError( string("StateDataDefn::ParseXML"), string("invalid mechanism") );
-        hasError = true;
+        Logger::GetLogger()->LogError( string("StateDataDefn::ParseXML"), string("mechanism without control file") );
+        return stateData;
     }
 
-    if ( !hasError && mech != nullptr)
-    {
-        auto mechFile = mech->GetControlFileName();
-        if (mechFile.empty())
-        {
-            Logger::GetLogger()->LogError( string("StateDataDefn::ParseXML"), string("mechanism without control file") );
-            hasError = true;
-        }
+    // load the xml file into memory (parse it)
+    filename += controlFile;
+    xml_document doc;
+    xml_parse_result result = doc.load_file(filename.c_str());
 
-        if (!hasError)
-        {
-            // load the xml file into memory (parse it)
-            filename += mechFile;
-            xml_document doc;
-            xml_parse_result result = doc.load_file(filename.c_str());
-
-            // if it is good
-            if (result)
+    // if it is good
+    if (result)
+    {
+        unique_ptr<ControlDataDefn> controlDataXML = make_unique<ControlDataDefn>();
+        unique_ptr<MechanismTargetDefn> mechanismTargetXML = make_unique<MechanismTargetDefn>();
+        unique_ptr<ShotMapDefn> shotMapXML = make_unique<ShotMapDefn>();
+
+        // get the root node <robot>
+        xml_node parent = doc.root();
+        for (xml_node node = parent.first_child(); node; node = node.next_sibling())
+        {   
+            // loop through the direct children of <robot> and call the appropriate parser
+            for (xml_node child = node.first_child(); child; child = child.next_sibling())
             {
-                unique_ptr<ControlDataDefn> controlDataXML = make_unique<ControlDataDefn>();
-                unique_ptr<MechanismTargetDefn> mechanismTargetXML = make_unique<MechanismTargetDefn>();
-
-                vector<ControlData*> controlDataVector;
-
-                // get the root node <robot>
-                xml_node parent = doc.root();
-                for (xml_node node = parent.first_child(); node; node = node.next_sibling())
-                {   
-                    // loop through the direct children of <robot> and call the appropriate parser
-                    for (xml_node child = node.first_child(); child; child = child.next_sibling())
+                if (strcmp(child.name(), "controlData") == 0)
+                {
+                    unique_ptr<ControlData> controlData( controlDataXML.get()->ParseXML( child ) );
+                    if ( controlData.get() != nullptr )
                     {
-                        if (strcmp(child.name(), "controlData") == 0)
-                        {
-                            controlDataVector.push_back( controlDataXML.get()->ParseXML( child ) );
-                        }
-                        else if (strcmp(child.name(), "mechanismTarget") == 0)
-                        {
-                            targetDataVector.push_back( mechanismTargetXML.get()->ParseXML( child ) );
-                        }
-                        else
-                        {
-                            string msg = "unknown child ";
-                            msg += child.name();
-                            Logger::GetLogger()->LogError( "StateDataDefn::ParseXML", msg );
-                        }
+                        stateData->controlData.emplace_back( *controlData );
                     }
                 }
-                
-                for ( auto td : targetDataVector )
+                else if (strcmp(child.name(), "mechanismTarget") == 0)
                 {
-                    td->Update( controlDataVector );
+                    unique_ptr<MechanismTargetData> targetData( mechanismTargetXML.get()->ParseXML( child ) );
+                    if ( targetData.get() != nullptr )
+                    {
+                        stateData->targetData.emplace_back( *targetData );
+                    }
+                }
+                else if (strcmp(child.name(), "shotMap") == 0)
+                {
+                    auto points = shotMapXML.get()->ParseXML( child );
+                    stateData->shotMap.insert( stateData->shotMap.end(), points.begin(), points.end() );
+                }
+                else if (strcmp(child.name(), "readiness") == 0)
+                {
+                    stateData->feedLeadTime = child.attribute("feedLeadTime").as_double( 0.0 );
+                }
+                else
+                {
+                    string msg = "unknown child ";
+                    msg += child.name();
+                    Logger::GetLogger()->LogError( "StateDataDefn::ParseXML", msg );
                 }
-            }
-            else
-            {
-                string msg = "XML [";
-                msg += filename;
-                msg += "] parsed with errors, attr value: [";
-                msg += doc.child( "prototype" ).attribute( "attr" ).value();
-                msg += "]";
-                Logger::GetLogger()->LogError( "StateDataDefn::ParseXML (1) ", msg );
-
-                msg = "Error description: ";
-                msg += result.description();
-                Logger::GetLogger()->LogError( "StateDataDefn::ParseXML (2) ", msg );
-
-                msg = "Error offset: ";
-                msg += result.offset;
-                msg += " error at ...";
-                msg += filename;
-                msg += result.offset;
-                Logger::GetLogger()->LogError( "StateDataDefn::ParseXML (3) ", msg );
             }
         }
+        
+        // now that the control data won't move, point the targets at it
+        vector<ControlData*> controlDataVector;
+        controlDataVector.reserve( stateData->controlData.size() );
+        for ( auto& cd : stateData->controlData )
+        {
+            controlDataVector.emplace_back( &cd );
+        }
+        for ( auto& td : stateData->targetData )
+        {
+            td.Update( controlDataVector );
+        }
+    }
+    else
+    {
+        string msg = "XML [";
+        msg += filename;
+        msg += "] parsed with errors, attr value: [";
+        msg += doc.child( "prototype" ).attribute( "attr" ).value();
+        msg += "]";
+        Logger::GetLogger()->LogError( "StateDataDefn::ParseXML (1) ", msg );
+
+        msg = "Error description: ";
+        msg += result.description();
+        Logger::GetLogger()->LogError( "StateDataDefn::ParseXML (2) ", msg );
+
+        msg = "Error offset: ";
+        msg += result.offset;
+        msg += " error at ...";
+        msg += filename;
+        msg += result.offset;
+        Logger::GetLogger()->LogError( "StateDataDefn::ParseXML (3) ", msg );
     }
-    return targetDataVector;
+    return stateData;
 }
@@ -15,10 +15,13 @@
 //====================================================================================================================================================
 
 #pragma once
+#include <memory>
+#include <string>
 #include <vector>
 
-#include <subsys/MechanismTypes.h>
+#include <controllers/ControlData.h>
 #include <controllers/MechanismTargetData.h>
+#include <controllers/ShotMap.h>
 
 //========================================================================================================
 /// StateDataDefn.h
@@ -31,9 +34,22 @@
 ///     This parsing leverages the 3rd party Open Source Pugixml library (https://pugixml.org/).
 ///
 ///     The state definition XML files are in:  /home/lvuser/config/states/XXX.xml where the XXX
-///     is the mechanism name.
+///     is the mechanism name.  Use the StateDataCache to get the data, so each file is only parsed once.
 ///
 //========================================================================================================
+
+/// @brief  The parsed contents of a state file.  The control data and targets are each stored in one
+///         contiguous block;  the targets' controllers point into controlData, so it is never changed
+///         once the file is parsed.  shotMap has the calibrated shots and feedLeadTime the seconds
+///         a ball takes to reach the wheels (only the shooter has them).
+struct StateData
+{
+    std::vector<ControlData>            controlData;
+    std::vector<MechanismTargetData>    targetData;
+    std::vector<ShotMap::Point>         shotMap;
+    double                              feedLeadTime = 0.0;
+};
+
 class StateDataDefn
 {
     public:
@@ -41,10 +57,10 @@ class StateDataDefn
         virtual ~StateDataDefn() = default;
 
         /// @brief      Parse a mechanismState.xml file
-        /// @param [in] MechanismTypes::MECHANISM_TYPE  - mechanism that the states are for
-        /// @return     state data
-        std::vector<MechanismTargetData*> ParseXML
+        /// @param [in] const std::string& controlFile - file in the deploy/states directory
+        /// @return     std::unique_ptr<StateData> - state data (no targets if the file couldn't be parsed)
+        std::unique_ptr<StateData> ParseXML
         (
-            MechanismTypes::MECHANISM_TYPE mechanism
+            const std::string&  controlFile
         );
 };
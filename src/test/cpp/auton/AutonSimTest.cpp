@@ -0,0 +1,521 @@
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302 
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+// C++ Includes
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// FRC includes
+#include <frc/geometry/Pose2d.h>
+#include <frc/geometry/Rotation2d.h>
+#include <frc/geometry/Translation2d.h>
+#include <frc/kinematics/ChassisSpeeds.h>
+#include <frc/Filesystem.h>
+#include <frc/Timer.h>
+#include <frc/simulation/SimHooks.h>
+#include <units/angle.h>
+#include <units/angular_velocity.h>
+#include <units/length.h>
+#include <units/time.h>
+#include <units/velocity.h>
+
+// Team 302 includes
+#include <auton/AutonProgram.h>
+#include <auton/AutonSelector.h>
+#include <auton/AutonTimeline.h>
+#include <auton/CyclePrimitives.h>
+#include <auton/PrimitiveEnums.h>
+#include <auton/PrimitiveParams.h>
+#include <auton/PrimitiveParser.h>
+#include <auton/TrajectoryCache.h>
+#include <states/intake/IntakeStateMgr.h>
+#include <states/shooter/ShooterStateMgr.h>
+#include <subsys/ChassisFactory.h>
+#include <subsys/interfaces/IChassis.h>
+
+// Third Party Includes
+#include "gtest/gtest.h"
+
+using namespace std;
+
+/// Runs every auton in deploy/auton through CyclePrimitives against a simulated chassis, with the
+/// robot clock paused and stepped one loop at a time (so it runs much faster than real time).
+/// For each auton it reports when the last primitive that does something finished (the autons end
+/// by doing nothing until the period is over), the distance from the end of the last path, how long
+/// each primitive ran and how long CyclePrimitives::Run took.
+///
+/// It fails if the work doesn't finish within the 15 s auton period, a primitive runs past its time
+/// budget, the auton got slower or ends farther from its target than AutonSimBaseline.csv (same
+/// format as the build/autonSim.csv this writes) allows, or the auton isn't in the baseline; copy
+/// build/autonSim.csv over it to update it.  The loop times depend on the machine running the test,
+/// so they are only reported.
+namespace
+{
+    constexpr double LOOP_TIME          = 0.02;     // seconds
+    constexpr double AUTON_TIME         = 15.0;     // seconds
+    constexpr double TIME_TOLERANCE     = 0.25;     // seconds slower than the baseline
+    constexpr double POSE_TOLERANCE     = 0.10;     // meters farther than the baseline
+
+    const string baselineFile("src/test/cpp/auton/AutonSimBaseline.csv");
+    const string resultsFile("build/autonSim.csv");
+    const string testAutonDir("/src/test/cpp/auton/");    // autons that only the tests run (from the launch directory)
+
+    string GetTestAuton
+    (
+        const string&   file
+    )
+    {
+        return frc::filesystem::GetLaunchDirectory() + testAutonDir + file;
+    }
+
+    /// @brief  Chassis that moves like the swerve drive (acceleration limited) without any hardware
+    class SimChassis : public IChassis
+    {
+        public:
+            SimChassis() : m_pose(), m_commanded(), m_speeds(), m_fieldOriented(false)
+            {
+            }
+
+            CHASSIS_TYPE GetType() const override { return CHASSIS_TYPE::SWERVE; }
+
+            void Drive
+            (
+                frc::ChassisSpeeds  chassisSpeeds,
+                CHASSIS_DRIVE_MODE  mode,
+                HEADING_OPTION      headingOption
+            ) override
+            {
+                m_commanded = chassisSpeeds;
+                m_fieldOriented = mode == CHASSIS_DRIVE_MODE::FIELD_ORIENTED;
+            }
+
+            void Initialize() override {}
+            frc::Pose2d GetPose() const override { return m_pose; }
+            void ResetPosition(const frc::Pose2d& pose) override { m_pose = pose; }
+            void UpdateOdometry() override {}
+            units::length::inch_t GetWheelDiameter() const override { return units::length::inch_t(4.0); }
+            units::length::inch_t GetTrack() const override { return units::length::inch_t(22.0); }
+            units::velocity::meters_per_second_t GetMaxSpeed() const override { return units::velocity::meters_per_second_t(MAX_SPEED); }
+            units::angular_velocity::radians_per_second_t GetMaxAngularSpeed() const override { return units::angular_velocity::radians_per_second_t(MAX_OMEGA); }
+            bool IsMoving() const override { return hypot(m_speeds.vx.to<double>(), m_speeds.vy.to<double>()) > 0.05; }
+            units::angle::degree_t GetYaw() const override { return m_pose.Rotation().Degrees(); }
+            void SetTargetHeading(units::angle::degree_t targetYaw) override {}
+            void SetEncodersToZero() override {}
+
+            /// @brief  Advance one loop:  move the (field relative) speeds toward the command and integrate the pose
+            void Step
+            (
+                double  dt
+            )
+            {
+                auto vx = m_commanded.vx.to<double>();
+                auto vy = m_commanded.vy.to<double>();
+                if ( !m_fieldOriented )
+                {
+                    auto heading = m_pose.Rotation().Radians().to<double>();
+                    auto fx = vx * cos(heading) - vy * sin(heading);
+                    vy = vx * sin(heading) + vy * cos(heading);
+                    vx = fx;
+                }
+                auto speed = hypot(vx, vy);
+                if ( speed > MAX_SPEED )
+                {
+                    vx *= MAX_SPEED / speed;
+                    vy *= MAX_SPEED / speed;
+                }
+
+                auto dvx = vx - m_speeds.vx.to<double>();
+                auto dvy = vy - m_speeds.vy.to<double>();
+                auto dv = hypot(dvx, dvy);
+                auto maxDv = MAX_ACCEL * dt;
+                if ( dv > maxDv )
+                {
+                    dvx *= maxDv / dv;
+                    dvy *= maxDv / dv;
+                }
+                m_speeds.vx = units::velocity::meters_per_second_t(m_speeds.vx.to<double>() + dvx);
+                m_speeds.vy = units::velocity::meters_per_second_t(m_speeds.vy.to<double>() + dvy);
+                m_speeds.omega = units::angular_velocity::radians_per_second_t(clamp(m_commanded.omega.to<double>(), -MAX_OMEGA, MAX_OMEGA));
+
+                m_pose = frc::Pose2d(m_pose.X() + units::length::meter_t(m_speeds.vx.to<double>() * dt),
+                                     m_pose.Y() + units::length::meter_t(m_speeds.vy.to<double>() * dt),
+                                     m_pose.Rotation() + frc::Rotation2d(units::angle::radian_t(m_speeds.omega.to<double>() * dt)));
+            }
+
+            void Stop()
+            {
+                m_commanded = frc::ChassisSpeeds();
+                m_speeds = frc::ChassisSpeeds();
+            }
+
+        private:
+            static constexpr double MAX_SPEED = 4.0;    // meters per second
+            static constexpr double MAX_ACCEL = 4.0;    // meters per second squared
+            static constexpr double MAX_OMEGA = 6.0;    // radians per second
+
+            frc::Pose2d         m_pose;
+            frc::ChassisSpeeds  m_commanded;
+            frc::ChassisSpeeds  m_speeds;           // field relative
+            bool                m_fieldOriented;
+    };
+
+    /// @brief  CyclePrimitives with stand-ins for the intake and shooter state managers (the real ones
+    ///         need the mechanisms):  it keeps the states the auton sets
+    class StubMechanismCyclePrimitives : public CyclePrimitives
+    {
+        public:
+            StubMechanismCyclePrimitives() : CyclePrimitives(),
+                                             m_leftIntake(IntakeStateMgr::INTAKE_STATE::OFF),
+                                             m_rightIntake(IntakeStateMgr::INTAKE_STATE::OFF),
+                                             m_shooter(ShooterStateMgr::SHOOTER_STATE::PREPARE_TO_SHOOT)
+            {
+            }
+
+            IntakeStateMgr::INTAKE_STATE GetLeftIntakeState() const { return m_leftIntake; }
+            IntakeStateMgr::INTAKE_STATE GetRightIntakeState() const { return m_rightIntake; }
+            ShooterStateMgr::SHOOTER_STATE GetShooterState() const { return m_shooter; }
+
+        protected:
+            void SetMechanismStates
+            (
+                const PrimitiveParams*  leftIntake,
+                const PrimitiveParams*  rightIntake,
+                const PrimitiveParams*  shooter
+            ) override
+            {
+                m_leftIntake = leftIntake != nullptr ? leftIntake->GetLeftIntakeState() : m_leftIntake;
+                m_rightIntake = rightIntake != nullptr ? rightIntake->GetRightIntakeState() : m_rightIntake;
+                m_shooter = shooter != nullptr ? shooter->GetShooterState() : m_shooter;
+            }
+
+        private:
+            IntakeStateMgr::INTAKE_STATE    m_leftIntake;
+            IntakeStateMgr::INTAKE_STATE    m_rightIntake;
+            ShooterStateMgr::SHOOTER_STATE  m_shooter;
+    };
+
+    struct AutonResult
+    {
+        bool            finished;           // the work finished within the auton period
+        double          workTime;           // seconds until the last primitive that isn't DO_NOTHING ended
+        double          poseError;          // meters from the end of the last path (-1 if there is no path)
+        vector<double>  primitiveTimes;     // seconds each primitive ran
+        double          meanLoopUs;
+        double          p99LoopUs;
+        double          maxLoopUs;
+    };
+
+    struct Baseline
+    {
+        double  workTime;
+        double  poseError;
+    };
+
+    map<string, Baseline> ReadBaseline()
+    {
+        map<string, Baseline> baseline;
+        ifstream file(baselineFile);
+        string line;
+        while ( getline(file, line) )
+        {
+            if ( line.empty() || line[0] == '#' || line.rfind("auton,", 0) == 0 )
+            {
+                continue;
+            }
+            stringstream fields(line);
+            string name;
+            string workTime;
+            string poseError;
+            if ( getline(fields, name, ',') && getline(fields, workTime, ',') && getline(fields, poseError, ',') )
+            {
+                baseline[name] = Baseline{ stod(workTime), stod(poseError) };
+            }
+        }
+        return baseline;
+    }
+
+    /// @brief  Where the auton should end up:  the end of the last path it drives
+    bool GetTargetPose
+    (
+        const AutonProgram&     program,
+        frc::Pose2d&            target
+    )
+    {
+        auto found = false;
+        for ( auto& params : program )
+        {
+            if ( params.GetID() == DRIVE_PATH && !params.GetPathName().empty() )
+            {
+                auto trajectory = TrajectoryCache::GetInstance()->GetTrajectory(params.GetPathName());
+                if ( trajectory.get() != nullptr && !trajectory.get()->Empty() )
+                {
+                    target = BinaryTrajectory::ToState(trajectory.get()->GetState(trajectory.get()->Size()-1)).pose;
+                    found = true;
+                }
+            }
+            else if ( params.GetID() == DRIVE_TO_POSE )
+            {
+                target = frc::Pose2d(units::length::meter_t(params.GetXLocation()),
+                                     units::length::meter_t(params.GetYLocation()),
+                                     frc::Rotation2d(units::angle::degree_t(params.GetHeading())));
+                found = true;
+            }
+        }
+        return found;
+    }
+}
+
+class AutonSimTest : public ::testing::Test
+{
+    protected:
+        static void SetUpTestSuite()
+        {
+            // the primitives get the chassis when they are created, so this has to come first
+            m_chassis = new SimChassis();
+            ChassisFactory::GetChassisFactory()->SetChassis(m_chassis);
+            m_cyclePrims = new StubMechanismCyclePrimitives();
+            frc::sim::PauseTiming();
+        }
+
+        static void TearDownTestSuite()
+        {
+            frc::sim::ResumeTiming();
+        }
+
+        AutonResult Run
+        (
+            const string&               autonFile,
+            const function<void()>&     afterLoop = nullptr     // called after each loop
+        )
+        {
+            AutonResult result{ false, 0.0, -1.0, vector<double>(), 0.0, 0.0, 0.0 };
+            auto program = PrimitiveParser::ParseXML(autonFile, nullptr, false);
+            result.primitiveTimes.assign(program->Size(), 0.0);
+
+            m_chassis->Stop();
+            m_chassis->ResetPosition(frc::Pose2d());
+
+            vector<double> loopTimes;
+            loopTimes.reserve(static_cast<size_t>(AUTON_TIME / LOOP_TIME) + 1);
+            auto simTime = 0.0;
+
+            auto autonStart = frc::Timer::GetFPGATimestamp().value();
+            m_cyclePrims->Init(autonFile);
+            while ( simTime < AUTON_TIME && !m_cyclePrims->AtTarget() )
+            {
+                auto start = chrono::steady_clock::now();
+                m_cyclePrims->Run();
+                auto end = chrono::steady_clock::now();
+                loopTimes.emplace_back(chrono::duration<double, micro>(end - start).count());
+                if ( afterLoop )
+                {
+                    afterLoop();
+                }
+
+                m_chassis->Step(LOOP_TIME);
+                frc::sim::StepTiming(units::second_t(LOOP_TIME));
+                simTime += LOOP_TIME;
+            }
+
+            // the timeline has when each primitive (including the ones in groups) started and ended;  
+            // the work is finished when every primitive that isn't DO_NOTHING has ended
+            vector<bool> ended(program->Size(), false);
+            auto& timeline = m_cyclePrims->GetTimeline();
+            for ( size_t inx=0; inx<timeline.Size(); ++inx )
+            {
+                auto& entry = timeline.GetEntry(inx);
+                if ( entry.reason != nullptr && entry.slot < program->Size() )
+                {
+                    ended[entry.slot] = true;
+                    result.primitiveTimes[entry.slot] = entry.end - entry.start;
+                    if ( entry.id != DO_NOTHING )
+                    {
+                        result.workTime = max(result.workTime, entry.end - autonStart);
+                    }
+                }
+            }
+            result.finished = true;
+            for ( size_t inx=0; inx<program->Size(); ++inx )
+            {
+                if ( program->GetParams(inx)->GetID() != DO_NOTHING && !ended[inx] )
+                {
+                    result.finished = false;
+                }
+            }
+
+            frc::Pose2d target;
+            if ( GetTargetPose(*program, target) )
+            {
+                result.poseError = m_chassis->GetPose().Translation().Distance(target.Translation()).to<double>();
+            }
+
+            if ( !loopTimes.empty() )
+            {
+                auto total = 0.0;
+                for ( auto time : loopTimes )
+                {
+                    total += time;
+                }
+                result.meanLoopUs = total / loopTimes.size();
+                result.maxLoopUs = *max_element(loopTimes.begin(), loopTimes.end());
+                auto p99 = loopTimes.begin() + static_cast<long>((loopTimes.size() - 1) * 99 / 100);
+                nth_element(loopTimes.begin(), p99, loopTimes.end());
+                result.p99LoopUs = *p99;
+            }
+            return result;
+        }
+
+        static SimChassis*                      m_chassis;
+        static StubMechanismCyclePrimitives*    m_cyclePrims;
+};
+
+SimChassis*                   AutonSimTest::m_chassis = nullptr;
+StubMechanismCyclePrimitives* AutonSimTest::m_cyclePrims = nullptr;
+
+TEST_F(AutonSimTest, RunsEveryAuton)
+{
+    auto files = AutonSelector::GetAutonFileNames();
+    sort(files.begin(), files.end());
+    ASSERT_FALSE(files.empty());
+
+    auto baseline = ReadBaseline();
+    ofstream results(resultsFile);
+    results << "auton,workTime,poseError,meanLoopUs,p99LoopUs,maxLoopUs,primitiveTimes" << endl;
+
+    for ( auto& file : files )
+    {
+        SCOPED_TRACE(file);
+        auto program = PrimitiveParser::ParseXML(file, nullptr, false);
+        auto result = Run(file);
+
+        cout << left << setw(28) << file << fixed << setprecision(2)
+             << " work " << result.workTime << " s"
+             << "  pose error " << result.poseError << " m"
+             << "  loop mean/p99/max " << setprecision(0) << result.meanLoopUs << "/" << result.p99LoopUs << "/" << result.maxLoopUs << " us" << endl;
+        results << file << fixed << setprecision(3) << "," << result.workTime << "," << result.poseError << ","
+                << result.meanLoopUs << "," << result.p99LoopUs << "," << result.maxLoopUs << ",";
+        for ( size_t inx=0; inx<result.primitiveTimes.size(); ++inx )
+        {
+            results << (inx > 0 ? " " : "") << result.primitiveTimes[inx];
+        }
+        results << endl;
+        RecordProperty(file + "_workTime", to_string(result.workTime));
+        RecordProperty(file + "_poseError", to_string(result.poseError));
+        RecordProperty(file + "_maxLoopUs", to_string(result.maxLoopUs));
+
+        EXPECT_TRUE(result.finished) << "didn't finish in " << AUTON_TIME << " s";
+
+        for ( size_t inx=0; inx<result.primitiveTimes.size(); ++inx )
+        {
+            auto budget = program->GetParams(inx)->GetTime();
+            if ( budget > 0.0 && result.primitiveTimes[inx] > 0.0 )
+            {
+                EXPECT_LE(result.primitiveTimes[inx], budget + 2.0 * LOOP_TIME) << "primitive " << inx + 1 << " ran past its time";
+            }
+        }
+
+        auto itr = baseline.find(file);
+        if ( itr != baseline.end() )
+        {
+            EXPECT_LE(result.workTime, itr->second.workTime + TIME_TOLERANCE) << "slower than the baseline";
+            if ( itr->second.poseError >= 0.0 )
+            {
+                EXPECT_LE(result.poseError, itr->second.poseError + POSE_TOLERANCE) << "farther from the target than the baseline";
+            }
+        }
+        else
+        {
+            ADD_FAILURE() << "not in " << baselineFile;
+        }
+    }
+}
+
+TEST_F(AutonSimTest, RunsGroups)
+{
+    // RESET_POSITION, parallel (DRIVE_PATH, RUN_MECHANISMS), DO_NOTHING, deadline (DRIVE_PATH, RUN_MECHANISMS), ...
+    const string file(GetTestAuton("twoBallRightGroups.xml"));
+    constexpr size_t parallel = 1;
+    constexpr size_t deadline = 4;
+
+    auto program = PrimitiveParser::ParseXML(file, nullptr, false);
+    ASSERT_GT(program->Size(), deadline + 1);
+    auto drive = program->GetParams(deadline);
+    auto mechanisms = program->GetParams(deadline + 1);
+    ASSERT_EQ(DRIVE_PATH, drive->GetID());
+    ASSERT_EQ(RUN_MECHANISMS, mechanisms->GetID());
+    EXPECT_TRUE(drive->HasRightIntakeState());
+    EXPECT_FALSE(drive->HasLeftIntakeState());
+    EXPECT_FALSE(drive->HasShooterState());
+    EXPECT_FALSE(mechanisms->HasRightIntakeState());
+
+    // while the deadline runs, the drive's right intake state isn't undone by the RUN_MECHANISMS default 
+    // and the RUN_MECHANISMS left intake state isn't undone by the drive's default
+    auto checkedLoops = 0;
+    auto result = Run(file, [&]()
+    {
+        auto& timeline = m_cyclePrims->GetTimeline();
+        auto inDeadline = false;
+        for ( size_t inx=0; inx<timeline.Size(); ++inx )
+        {
+            auto& entry = timeline.GetEntry(inx);
+            inDeadline = inDeadline || (entry.slot == deadline && entry.reason == nullptr);
+        }
+        if ( inDeadline )
+        {
+            EXPECT_EQ(IntakeStateMgr::INTAKE_STATE::INTAKE, m_cyclePrims->GetLeftIntakeState());
+            EXPECT_EQ(IntakeStateMgr::INTAKE_STATE::INTAKE, m_cyclePrims->GetRightIntakeState());
+            checkedLoops++;
+        }
+    });
+    EXPECT_TRUE(result.finished);
+    EXPECT_GT(checkedLoops, 0) << "the deadline group never ran";
+
+    // the primitives in a group start together, and the deadline's drive ends its RUN_MECHANISMS
+    map<size_t, AutonTimeline::Entry> entries;
+    auto& timeline = m_cyclePrims->GetTimeline();
+    for ( size_t inx=0; inx<timeline.Size(); ++inx )
+    {
+        entries[timeline.GetEntry(inx).slot] = timeline.GetEntry(inx);
+    }
+    ASSERT_EQ(1u, entries.count(parallel));
+    ASSERT_EQ(1u, entries.count(parallel + 1));
+    ASSERT_EQ(1u, entries.count(deadline));
+    ASSERT_EQ(1u, entries.count(deadline + 1));
+    EXPECT_DOUBLE_EQ(entries[parallel].start, entries[parallel + 1].start);
+    EXPECT_DOUBLE_EQ(entries[deadline].start, entries[deadline + 1].start);
+    EXPECT_DOUBLE_EQ(entries[deadline].end, entries[deadline + 1].end);
+    ASSERT_NE(nullptr, entries[deadline + 1].reason);
+    EXPECT_STREQ("interrupted", entries[deadline + 1].reason);
+}
+
+TEST_F(AutonSimTest, RejectsInvalidGroup)
+{
+    // a parallel group with two primitives that drive the chassis
+    vector<string> errors;
+    auto program = PrimitiveParser::ParseXML(GetTestAuton("invalidGroup.xml"), &errors, false);
+    EXPECT_TRUE(program->Empty());
+    ASSERT_EQ(1u, errors.size());
+    EXPECT_NE(string::npos, errors[0].find("more than one primitive that drives the chassis"));
+}
@@ -0,0 +1,160 @@
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302 
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+// C++ Includes
+#include <cmath>
+#include <string>
+#include <vector>
+
+// FRC includes
+#include <frc/geometry/Translation2d.h>
+#include <units/length.h>
+
+// Team 302 includes
+#include <auton/BinaryTrajectory.h>
+#include <auton/PathPlannerLoader.h>
+
+// Third Party Includes
+#include "gtest/gtest.h"
+
+using namespace std;
+
+namespace
+{
+    constexpr double maxVelocity = 2.0;
+    constexpr double maxAcceleration = 1.5;
+    constexpr double tolerance = 1e-9;
+
+    frc::Translation2d Point(double x, double y)
+    {
+        return frc::Translation2d(units::meter_t(x), units::meter_t(y));
+    }
+
+    PathPlannerLoader::Waypoint MakeWaypoint
+    (
+        frc::Translation2d  anchor,
+        frc::Translation2d  prevControl,
+        frc::Translation2d  nextControl,
+        bool                isReversal = false,
+        double              velOverride = 0.0
+    )
+    {
+        return PathPlannerLoader::Waypoint{ anchor, prevControl, nextControl, 0.0, isReversal, velOverride };
+    }
+
+    /// @brief  checks every generated path has to pass:  starts and ends stopped, time strictly 
+    ///         increases, the speed is within the limit and the turn's centripetal acceleration
+    void CheckStates(const vector<BinaryTrajectoryState>& states, double limit, const string& name)
+    {
+        ASSERT_GT(states.size(), 2u) << name;
+        EXPECT_DOUBLE_EQ(0.0, states.front().time) << name;
+        EXPECT_NEAR(0.0, states.front().velocity, tolerance) << name;
+        EXPECT_NEAR(0.0, states.back().velocity, tolerance) << name;
+
+        for ( size_t inx=0; inx<states.size(); ++inx )
+        {
+            auto& state = states[inx];
+            EXPECT_LE(abs(state.velocity), limit + tolerance) << name << " state " << inx;
+            EXPECT_LE(state.velocity * state.velocity * abs(state.curvature), maxAcceleration + 1e-6) << name << " state " << inx;
+            if ( inx > 0 )
+            {
+                EXPECT_GT(state.time, states[inx-1].time) << name << " state " << inx;
+            }
+        }
+    }
+}
+
+TEST(PathPlannerLoaderTest, NeedsTwoWaypoints)
+{
+    vector<PathPlannerLoader::Waypoint> waypoints{ MakeWaypoint(Point(0.0, 0.0), Point(0.0, 0.0), Point(1.0, 0.0)) };
+    EXPECT_TRUE(PathPlannerLoader::Generate(waypoints, maxVelocity, maxAcceleration).empty());
+}
+
+TEST(PathPlannerLoaderTest, StraightLine)
+{
+    vector<PathPlannerLoader::Waypoint> waypoints{ MakeWaypoint(Point(0.0, 0.0), Point(0.0, 0.0), Point(1.0, 0.0)),
+                                                   MakeWaypoint(Point(4.0, 0.0), Point(3.0, 0.0), Point(4.0, 0.0)) };
+    auto states = PathPlannerLoader::Generate(waypoints, maxVelocity, maxAcceleration);
+    CheckStates(states, maxVelocity, "straight");
+
+    // long enough to reach the velocity limit, and it ends at the last anchor
+    auto fastest = 0.0;
+    for ( auto& state : states )
+    {
+        fastest = max(fastest, state.velocity);
+        EXPECT_LE(abs(state.acceleration), maxAcceleration + 1e-6);
+    }
+    EXPECT_NEAR(maxVelocity, fastest, 1e-6);
+    EXPECT_NEAR(4.0, states.back().x, tolerance);
+    EXPECT_NEAR(0.0, states.back().y, tolerance);
+}
+
+TEST(PathPlannerLoaderTest, TightTurnWithVelocityOverride)
+{
+    // a quarter turn with a small radius (curvature limited) after a segment with a velocity override
+    constexpr double velOverride = 1.0;
+    vector<PathPlannerLoader::Waypoint> waypoints{ MakeWaypoint(Point(0.0, 0.0), Point(0.0, 0.0), Point(1.0, 0.0), false, velOverride),
+                                                   MakeWaypoint(Point(2.0, 0.0), Point(1.0, 0.0), Point(2.3, 0.0)),
+                                                   MakeWaypoint(Point(2.5, 0.5), Point(2.5, 0.2), Point(2.5, 0.5)) };
+    auto states = PathPlannerLoader::Generate(waypoints, maxVelocity, maxAcceleration);
+    CheckStates(states, maxVelocity, "turn");
+
+    // the override holds for the first segment (up to the middle anchor)
+    for ( auto& state : states )
+    {
+        if ( state.x < 2.0 - tolerance )
+        {
+            EXPECT_LE(abs(state.velocity), velOverride + tolerance) << "x=" << state.x;
+        }
+    }
+}
+
+TEST(PathPlannerLoaderTest, Reversal)
+{
+    // drive out 2 m, stop, and back up to the side
+    vector<PathPlannerLoader::Waypoint> waypoints{ MakeWaypoint(Point(0.0, 0.0), Point(0.0, 0.0), Point(0.7, 0.0)),
+                                                   MakeWaypoint(Point(2.0, 0.0), Point(1.3, 0.0), Point(1.3, 0.5), true),
+                                                   MakeWaypoint(Point(0.5, 1.0), Point(1.0, 1.0), Point(0.5, 1.0)) };
+    auto states = PathPlannerLoader::Generate(waypoints, maxVelocity, maxAcceleration);
+    CheckStates(states, maxVelocity, "reversal");
+
+    // the robot stops at the reversal point, which is only in the states once
+    size_t reversal = states.size();
+    for ( size_t inx=0; inx<states.size(); ++inx )
+    {
+        if ( abs(states[inx].x - 2.0) < tolerance && abs(states[inx].y) < tolerance )
+        {
+            EXPECT_EQ(states.size(), reversal) << "reversal point repeated";
+            reversal = inx;
+        }
+    }
+    ASSERT_LT(reversal, states.size());
+    EXPECT_NEAR(0.0, states[reversal].velocity, tolerance);
+
+    // forward before the reversal, backward after it
+    for ( size_t inx=0; inx<states.size(); ++inx )
+    {
+        if ( inx < reversal )
+        {
+            EXPECT_GE(states[inx].velocity, 0.0) << "state " << inx;
+        }
+        else if ( inx > reversal )
+        {
+            EXPECT_LE(states[inx].velocity, 0.0) << "state " << inx;
+        }
+    }
+    EXPECT_NEAR(0.5, states.back().x, tolerance);
+    EXPECT_NEAR(1.0, states.back().y, tolerance);
+}
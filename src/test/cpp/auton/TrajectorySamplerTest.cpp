@@ -0,0 +1,124 @@
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302 
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+// C++ Includes
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <string>
+
+// FRC includes
+#include <frc/Filesystem.h>
+#include <frc/trajectory/Trajectory.h>
+#include <frc/trajectory/TrajectoryUtil.h>
+#include <units/time.h>
+
+// Team 302 includes
+#include <auton/BinaryTrajectory.h>
+#include <auton/TrajectorySampler.h>
+
+// Third Party Includes
+#include "gtest/gtest.h"
+
+using namespace std;
+
+namespace
+{
+    // longest path in the five ball auton (fiveBallRight.xml)
+    const string fiveBallPath("fiveBallRight9copy.wpilib.json");
+
+    constexpr double loopTime = 0.02;
+    constexpr int    passes = 2000;
+
+    frc::Trajectory LoadFiveBallPath()
+    {
+        return frc::TrajectoryUtil::FromPathweaverJson(frc::filesystem::GetDeployDirectory() + "/paths/" + fiveBallPath);
+    }
+
+    template <typename SAMPLE>
+    double TimeSampling(double totalTime, SAMPLE sample)
+    {
+        auto start = chrono::steady_clock::now();
+        auto check = 0.0;
+        for ( auto pass=0; pass<passes; ++pass )
+        {
+            for ( auto t=0.0; t<=totalTime+loopTime; t+=loopTime )
+            {
+                check += sample(units::second_t(t)).velocity.template to<double>();
+            }
+        }
+        auto end = chrono::steady_clock::now();
+        EXPECT_TRUE(std::isfinite(check));
+        return chrono::duration<double, micro>(end - start).count() / passes;
+    }
+}
+
+TEST(TrajectorySamplerTest, MatchesTrajectorySample)
+{
+    auto trajectory = LoadFiveBallPath();
+    ASSERT_FALSE(trajectory.States().empty());
+
+    TrajectorySampler sampler(BinaryTrajectory::FromTrajectory(trajectory));
+    auto totalTime = trajectory.TotalTime().to<double>();
+    for ( auto t=0.0; t<=totalTime+loopTime; t+=loopTime )
+    {
+        auto expected = trajectory.Sample(units::second_t(t));
+        auto actual = sampler.Sample(units::second_t(t));
+        EXPECT_NEAR(expected.pose.X().to<double>(), actual.pose.X().to<double>(), 1e-9) << "t=" << t;
+        EXPECT_NEAR(expected.pose.Y().to<double>(), actual.pose.Y().to<double>(), 1e-9) << "t=" << t;
+        EXPECT_NEAR(expected.pose.Rotation().Radians().to<double>(), actual.pose.Rotation().Radians().to<double>(), 1e-9) << "t=" << t;
+        EXPECT_NEAR(expected.velocity.to<double>(), actual.velocity.to<double>(), 1e-9) << "t=" << t;
+    }
+}
+
+TEST(TrajectorySamplerTest, LookaheadAndRestart)
+{
+    auto trajectory = LoadFiveBallPath();
+    TrajectorySampler sampler(BinaryTrajectory::FromTrajectory(trajectory));
+
+    sampler.Sample(1.0_s);
+    auto cursor = sampler.GetCursor();
+    auto ahead = sampler.SampleAhead(1.0_s, 0.5_s);
+    EXPECT_EQ(cursor, sampler.GetCursor());
+    EXPECT_NEAR(trajectory.Sample(1.5_s).pose.X().to<double>(), ahead.pose.X().to<double>(), 1e-9);
+
+    // time going backwards restarts the search
+    auto start = sampler.Sample(0.0_s);
+    EXPECT_EQ(0u, sampler.GetCursor());
+    EXPECT_NEAR(trajectory.InitialPose().X().to<double>(), start.pose.X().to<double>(), 1e-9);
+
+    EXPECT_TRUE(sampler.IsFinished(trajectory.TotalTime()));
+}
+
+TEST(TrajectorySamplerTest, Benchmark)
+{
+    auto trajectory = LoadFiveBallPath();
+    auto binary = BinaryTrajectory::FromTrajectory(trajectory);
+    auto totalTime = trajectory.TotalTime().to<double>();
+
+    auto wpilib = TimeSampling(totalTime, [&trajectory](units::second_t t) { return trajectory.Sample(t); });
+    auto search = TimeSampling(totalTime, [&binary](units::second_t t) { return binary.get()->Sample(t); });
+    TrajectorySampler sampler(binary);
+    auto cursor = TimeSampling(totalTime, [&sampler](units::second_t t) { return sampler.Sample(t); });
+
+    cout << fiveBallPath << " (" << trajectory.States().size() << " states, " << totalTime << " s) microseconds per pass:" << endl;
+    cout << "  frc::Trajectory::Sample    " << wpilib << endl;
+    cout << "  BinaryTrajectory::Sample   " << search << endl;
+    cout << "  TrajectorySampler::Sample  " << cursor << endl;
+
+    RecordProperty("frcTrajectorySampleUs", to_string(wpilib));
+    RecordProperty("binaryTrajectorySampleUs", to_string(search));
+    RecordProperty("trajectorySamplerUs", to_string(cursor));
+}
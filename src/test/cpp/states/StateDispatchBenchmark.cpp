@@ -0,0 +1,186 @@
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302 
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+// C++ Includes
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+// FRC includes
+
+// Team 302 includes
+#include <states/IState.h>
+#include <states/StateSet.h>
+
+// Third Party Includes
+#include "gtest/gtest.h"
+
+using namespace std;
+
+namespace
+{
+    constexpr int numStates = 8;
+    constexpr int passes = 2000000;
+
+    /// @brief  stand-ins for the mechanism states:  a little arithmetic per Run, like a state that
+    ///         sets a target and checks it
+    class RampState : public IState
+    {
+        public:
+            explicit RampState(double step) : m_step(step) {}
+            void Init() override { m_value = 0.0; }
+            void Run() override { m_value += m_step; }
+            bool AtTarget() const override { return m_value > 1000.0; }
+            double GetValue() const { return m_value; }
+        private:
+            double m_step;
+            double m_value = 0.0;
+    };
+
+    class HoldState : public IState
+    {
+        public:
+            explicit HoldState(double target) : m_target(target) {}
+            void Init() override { m_value = 0.0; }
+            void Run() override { m_value += (m_target - m_value) * 0.5; }
+            bool AtTarget() const override { return m_value > m_target - 0.01; }
+            double GetValue() const { return m_value; }
+        private:
+            double m_target;
+            double m_value = 0.0;
+    };
+
+    class OffState : public IState
+    {
+        public:
+            void Init() override { m_value = 0.0; }
+            void Run() override { m_value = 0.0; }
+            bool AtTarget() const override { return true; }
+            double GetValue() const { return m_value; }
+        private:
+            double m_value = 0.0;
+    };
+
+    using BenchmarkStates = StateSet<RampState, HoldState, OffState>;
+
+    /// @brief  state slot to run on each pass;  changes every few passes like driver/auton transitions
+    vector<int> MakeSlots()
+    {
+        vector<int> slots(passes);
+        auto slot = 0;
+        for ( auto pass=0; pass<passes; ++pass )
+        {
+            if ( pass % 7 == 0 )
+            {
+                slot = (slot * 5 + 3) % numStates;
+            }
+            slots[pass] = slot;
+        }
+        return slots;
+    }
+
+    template <typename RUN>
+    double TimeDispatch(const vector<int>& slots, RUN run)
+    {
+        auto start = chrono::steady_clock::now();
+        auto atTarget = 0;
+        for ( auto slot : slots )
+        {
+            atTarget += run(slot) ? 1 : 0;
+        }
+        auto end = chrono::steady_clock::now();
+        EXPECT_GE(atTarget, 0);
+        return chrono::duration<double, nano>(end - start).count() / slots.size();
+    }
+}
+
+TEST(StateDispatchBenchmark, Benchmark)
+{
+    // virtual path:  individually allocated states called through IState*, like StateMgr
+    vector<unique_ptr<RampState>> ramps;
+    vector<unique_ptr<HoldState>> holds;
+    vector<unique_ptr<OffState>>  offs;
+    vector<IState*> virtualStates;
+
+    // static path:  the same states held by value in a StateSet, like StaticStateMgr
+    BenchmarkStates staticStates;
+    staticStates.Reserve(numStates);
+
+    for ( auto inx=0; inx<numStates; ++inx )
+    {
+        switch (inx % 3)
+        {
+            case 0:
+                ramps.emplace_back(make_unique<RampState>(0.001 * (inx + 1)));
+                virtualStates.emplace_back(ramps.back().get());
+                staticStates.Emplace<RampState>(inx, 0.001 * (inx + 1));
+                break;
+
+            case 1:
+                holds.emplace_back(make_unique<HoldState>(inx));
+                virtualStates.emplace_back(holds.back().get());
+                staticStates.Emplace<HoldState>(inx, inx);
+                break;
+
+            default:
+                offs.emplace_back(make_unique<OffState>());
+                virtualStates.emplace_back(offs.back().get());
+                staticStates.Emplace<OffState>(inx);
+                break;
+        }
+    }
+
+    auto slots = MakeSlots();
+    auto virtualNs = TimeDispatch(slots, [&virtualStates](int slot) { virtualStates[slot]->Run(); return virtualStates[slot]->AtTarget(); });
+    auto staticNs = TimeDispatch(slots, [&staticStates](int slot) { staticStates.Run(slot); return staticStates.AtTarget(slot); });
+
+    // both paths did the same work
+    auto virtualAtTarget = 0;
+    auto staticAtTarget = 0;
+    for ( auto inx=0; inx<numStates; ++inx )
+    {
+        virtualAtTarget += virtualStates[inx]->AtTarget() ? 1 : 0;
+        staticAtTarget += staticStates.AtTarget(inx) ? 1 : 0;
+    }
+    EXPECT_EQ(virtualAtTarget, staticAtTarget);
+
+    cout << numStates << " states, " << passes << " passes, nanoseconds per Run + AtTarget:" << endl;
+    cout << "  IState* (virtual)     " << virtualNs << endl;
+    cout << "  StateSet (static)     " << staticNs << endl;
+
+    RecordProperty("virtualDispatchNs", to_string(virtualNs));
+    RecordProperty("staticDispatchNs", to_string(staticNs));
+}
+
+TEST(StateDispatchBenchmark, EmptyAndInvalidSlots)
+{
+    StateSet<OffState, RampState> states;
+    states.Reserve(2);
+    EXPECT_EQ(2u, states.Size());
+    EXPECT_FALSE(states.AtTarget(0));
+    EXPECT_EQ(nullptr, states.Emplace<OffState>(2));
+
+    auto ramp = states.Emplace<RampState>(1, 2000.0);
+    ASSERT_NE(nullptr, ramp);
+    states.Run(1);
+    states.Run(-1);
+    EXPECT_TRUE(states.AtTarget(1));
+    EXPECT_DOUBLE_EQ(2000.0, ramp->GetValue());
+
+    states.Clear();
+    EXPECT_FALSE(states.AtTarget(1));
+}
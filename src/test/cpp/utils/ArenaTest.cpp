@@ -0,0 +1,117 @@
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302 
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+// C++ Includes
+#include <memory>
+#include <string>
+#include <vector>
+
+// FRC includes
+
+// Team 302 includes
+#include <utils/Arena.h>
+
+// Third Party Includes
+#include "gtest/gtest.h"
+
+using namespace std;
+
+namespace
+{
+    /// @brief  Object that records when it is destroyed
+    class Tracked
+    {
+        public:
+            Tracked(vector<string>& events, const string& name) : m_events(events), m_name(name) {}
+            ~Tracked() { m_events.emplace_back(string("destroy ") + m_name); }
+
+        private:
+            vector<string>&     m_events;
+            string              m_name;
+    };
+
+    /// @brief  Owner that creates its object in the arena and again when the arena is rebuilt (like StateMgr)
+    class Owner
+    {
+        public:
+            Owner(Arena& arena, vector<string>& events, const string& name) : m_arena(arena), m_events(events), m_name(name), m_object(nullptr)
+            {
+                m_arena.AddResetHandler([this]() { m_events.emplace_back(string("reset ") + m_name); m_object = nullptr; });
+                m_arena.AddRebuildHandler([this]() { Create(); });
+                Create();
+            }
+
+            const Tracked* GetObject() const { return m_object; }
+
+        private:
+            void Create()
+            {
+                m_events.emplace_back(string("create ") + m_name);
+                m_object = m_arena.Create<Tracked>(m_events, m_name);
+            }
+
+            Arena&              m_arena;
+            vector<string>&     m_events;
+            string              m_name;
+            Tracked*            m_object;
+    };
+}
+
+TEST(ArenaTest, ResetOnlyTearsDown)
+{
+    vector<string> events;
+    auto arena = make_unique<Arena>();
+    Owner first(*arena, events, "first");
+    Owner second(*arena, events, "second");
+    events.clear();
+
+    arena->Reset();
+    EXPECT_EQ(vector<string>({"reset first", "reset second", "destroy second", "destroy first"}), events);
+    EXPECT_EQ(nullptr, first.GetObject());
+    EXPECT_EQ(nullptr, second.GetObject());
+    EXPECT_EQ(0u, arena->BytesUsed());
+
+    // the arena's destructor calls the reset handlers, so it goes before the owners
+    arena.reset();
+}
+
+TEST(ArenaTest, RebuildCreatesAgain)
+{
+    vector<string> events;
+    auto arena = make_unique<Arena>();
+    Owner first(*arena, events, "first");
+    Owner second(*arena, events, "second");
+    auto used = arena->BytesUsed();
+    auto capacity = arena->Capacity();
+    events.clear();
+
+    // torn down like Reset, then created again in the order the owners were
+    arena->Rebuild();
+    EXPECT_EQ(vector<string>({"reset first", "reset second", "destroy second", "destroy first", "create first", "create second"}), events);
+    EXPECT_NE(nullptr, first.GetObject());
+    EXPECT_NE(nullptr, second.GetObject());
+
+    // the memory is reused
+    EXPECT_EQ(used, arena->BytesUsed());
+    EXPECT_EQ(capacity, arena->Capacity());
+
+    // rebuilding again works the same way
+    events.clear();
+    arena->Rebuild();
+    EXPECT_EQ(6u, events.size());
+    EXPECT_NE(nullptr, first.GetObject());
+
+    arena.reset();
+}